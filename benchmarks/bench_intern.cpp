@@ -0,0 +1,92 @@
+// benchmarks for the string intern pool
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/util/intern.hpp>
+
+using protowire::util::intern::intern_pool;
+using protowire::util::intern::interned;
+
+namespace {
+
+std::vector<std::string> make_keys(std::size_t n) {
+  std::vector<std::string> keys{};
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back("field_name_" + std::to_string(i));
+  }
+  return keys;
+}
+
+}  // namespace
+
+TEST_CASE("intern_pool: lookups") {
+  std::vector<std::string> const keys = make_keys(1000);
+
+  intern_pool pool{};
+  std::unordered_set<std::string> set{};
+  for (std::string const& k : keys) {
+    pool.intern(k);
+    set.insert(k);
+  }
+
+  BENCHMARK("intern_pool::intern, hits") {
+    std::size_t n = 0;
+    for (std::string const& k : keys) {
+      n += pool.intern(k).size();
+    }
+    return n;
+  };
+
+  BENCHMARK("std::unordered_set<std::string>::find") {
+    std::size_t n = 0;
+    for (std::string const& k : keys) {
+      n += set.find(k)->size();
+    }
+    return n;
+  };
+
+  BENCHMARK_ADVANCED("intern_pool::intern, new pool")
+  (Catch::Benchmark::Chronometer meter) {
+    std::vector<intern_pool> pools(static_cast<std::size_t>(meter.runs()));
+    meter.measure([&pools, &keys](int i) {
+      intern_pool& p = pools[static_cast<std::size_t>(i)];
+      for (std::string const& k : keys) {
+        p.intern(k);
+      }
+      return p.stats().strings;
+    });
+  };
+}
+
+TEST_CASE("intern_pool: concurrent hits") {
+  std::vector<std::string> const keys = make_keys(1000);
+  intern_pool pool{};
+  for (std::string const& k : keys) {
+    pool.intern(k);
+  }
+  unsigned const thread_count = std::max(2u, std::thread::hardware_concurrency());
+
+  BENCHMARK("intern_pool::intern, hits, " + std::to_string(thread_count) + " threads") {
+    std::vector<std::thread> threads{};
+    for (unsigned t = 0; t < thread_count; ++t) {
+      threads.emplace_back([&pool, &keys] {
+        for (std::string const& k : keys) {
+          pool.intern(k);
+        }
+      });
+    }
+    for (std::thread& th : threads) {
+      th.join();
+    }
+    return pool.stats().hits;
+  };
+}
@@ -0,0 +1,51 @@
+// benchmarks for LString comparisons
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/util/lstring.hpp>
+
+using protowire::util::lstring::LString;
+
+#define BENCH_TEXT_16 "0123456789abcdef"
+#define BENCH_TEXT_64 BENCH_TEXT_16 BENCH_TEXT_16 BENCH_TEXT_16 BENCH_TEXT_16
+#define BENCH_TEXT_512                                                                   \
+  BENCH_TEXT_64 BENCH_TEXT_64 BENCH_TEXT_64 BENCH_TEXT_64 BENCH_TEXT_64 BENCH_TEXT_64    \
+        BENCH_TEXT_64 BENCH_TEXT_64
+
+namespace {
+
+template <LString Name>
+void bench_compare(char const* label) {
+  // a runtime copy, equal in content
+  std::string const text{Name.view()};
+  std::string_view const view{text};
+
+  BENCHMARK(std::string{label} + ": LString == string_view") { return Name == view; };
+
+  BENCHMARK(std::string{label} + ": LString <=> string_view") {
+    return std::is_lt(Name <=> view);
+  };
+
+  BENCHMARK(std::string{label} + ": strncmp") {
+    return (view.size() + 1 == sizeof(Name.data))
+           && std::strncmp(view.data(), Name.data, view.size()) == 0;
+  };
+
+  BENCHMARK(std::string{label} + ": memcmp") {
+    return (view.size() == Name.size())
+           && std::memcmp(view.data(), Name.data, view.size()) == 0;
+  };
+}
+
+}  // namespace
+
+TEST_CASE("LString: equal content") {
+  bench_compare<BENCH_TEXT_16>("16 chars");
+  bench_compare<BENCH_TEXT_64>("64 chars");
+  bench_compare<BENCH_TEXT_512>("512 chars");
+}
@@ -0,0 +1,128 @@
+// benchmarks for dispatching a runtime string against LString literals
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/util/lstring.hpp>
+#include <protowire/util/lstring_map.hpp>
+
+using protowire::util::lstring::fnv1a_hash;
+using protowire::util::lstring::LString;
+using protowire::util::lstring::lstring_hash_v;
+using protowire::util::lstring::lstring_hasher;
+using protowire::util::lstring::lstring_kv;
+using protowire::util::lstring::lstring_map;
+using protowire::util::lstring::xxh64_hash;
+
+#define BENCH_KEY_COUNT 200
+#define BENCH_KEY(n) BOOST_PP_STRINGIZE(BOOST_PP_CAT(field_name_, n))
+
+namespace {
+
+constexpr std::size_t npos = BENCH_KEY_COUNT;
+
+/// linear comparison, in declaration order
+std::size_t dispatch_linear(std::string_view name) {
+#define BENCH_LINEAR(z, n, _)                                                            \
+  if (LString{BENCH_KEY(n)} == name) {                                                   \
+    return n;                                                                            \
+  }
+  BOOST_PP_REPEAT(BENCH_KEY_COUNT, BENCH_LINEAR, _)
+#undef BENCH_LINEAR
+  return npos;
+}
+
+/// switch on a precomputed hash, verified with one comparison
+template <typename Hash>
+std::size_t dispatch_hash(std::string_view name) {
+#define BENCH_CASE(z, n, _)                                                              \
+  case lstring_hash_v<BENCH_KEY(n), Hash>:                                               \
+    return (LString{BENCH_KEY(n)} == name) ? n : npos;
+  switch (lstring_hasher<Hash>{}(name)) {
+    BOOST_PP_REPEAT(BENCH_KEY_COUNT, BENCH_CASE, _)
+  default:
+    return npos;
+  }
+#undef BENCH_CASE
+}
+
+std::unordered_map<std::string_view, std::size_t> const& key_map() {
+  static std::unordered_map<std::string_view, std::size_t> const map = [] {
+    std::unordered_map<std::string_view, std::size_t> m{};
+#define BENCH_INSERT(z, n, _) m.emplace(BENCH_KEY(n), n);
+    BOOST_PP_REPEAT(BENCH_KEY_COUNT, BENCH_INSERT, _)
+#undef BENCH_INSERT
+    return m;
+  }();
+  return map;
+}
+
+std::size_t dispatch_map(std::string_view name) {
+  auto const& map = key_map();
+  auto const it = map.find(name);
+  return (it == map.end()) ? npos : it->second;
+}
+
+#define BENCH_ENTRY(z, n, _) lstring_kv{BENCH_KEY(n), std::size_t{n}}
+using key_lstring_map = lstring_map<BOOST_PP_ENUM(BENCH_KEY_COUNT, BENCH_ENTRY, _)>;
+#undef BENCH_ENTRY
+
+std::size_t dispatch_lstring_map(std::string_view name) {
+  std::size_t const* const value = key_lstring_map::find(name);
+  return (value == nullptr) ? npos : *value;
+}
+
+/// runtime copies of every key, plus one key not matched
+std::vector<std::string> const& inputs() {
+  static std::vector<std::string> const keys = [] {
+    std::vector<std::string> k{};
+#define BENCH_PUSH(z, n, _) k.emplace_back(BENCH_KEY(n));
+    BOOST_PP_REPEAT(BENCH_KEY_COUNT, BENCH_PUSH, _)
+#undef BENCH_PUSH
+    k.emplace_back("field_name_unknown");
+    return k;
+  }();
+  return keys;
+}
+
+template <typename F>
+std::size_t dispatch_all(F&& dispatch) {
+  std::size_t sum = 0;
+  for (std::string const& name : inputs()) {
+    sum += dispatch(name);
+  }
+  return sum;
+}
+
+}  // namespace
+
+TEST_CASE("LString dispatch: 200 literals") {
+  std::size_t const expected = dispatch_all(dispatch_linear);
+  REQUIRE(dispatch_all(dispatch_hash<fnv1a_hash>) == expected);
+  REQUIRE(dispatch_all(dispatch_hash<xxh64_hash>) == expected);
+  REQUIRE(dispatch_all(dispatch_map) == expected);
+  REQUIRE(dispatch_all(dispatch_lstring_map) == expected);
+
+  BENCHMARK("linear comparison") { return dispatch_all(dispatch_linear); };
+
+  BENCHMARK("switch on fnv1a_hash") {
+    return dispatch_all(dispatch_hash<fnv1a_hash>);
+  };
+
+  BENCHMARK("switch on xxh64_hash") { return dispatch_all(dispatch_hash<xxh64_hash>); };
+
+  BENCHMARK("std::unordered_map") { return dispatch_all(dispatch_map); };
+
+  BENCHMARK("lstring_map") { return dispatch_all(dispatch_lstring_map); };
+}
@@ -0,0 +1,158 @@
+// benchmarks for object_repr
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/repr_arena.hpp>
+
+using protowire::test::object_repr::byte_format;
+using protowire::test::object_repr::object_repr;
+using protowire::test::object_repr::repr_arena;
+using protowire::test::object_repr::repr_format_to;
+using protowire::test::object_repr::repr_inline;
+using protowire::test::object_repr::repr_string;
+using protowire::test::object_repr::scoped_repr_limits;
+
+namespace {
+
+template <typename T>
+void bench_repr(char const* label, T const& ob) {
+  std::string buf{};
+  buf.reserve(256);
+  std::ostringstream stream{};
+  repr_arena arena{};
+
+  BENCHMARK(std::string{label} + ": repr_string") { return repr_string(ob); };
+
+  BENCHMARK(std::string{label} + ": repr_format_to, reused buffer") {
+    buf.clear();
+    repr_format_to(ob, std::back_inserter(buf));
+    return buf.size();
+  };
+
+  BENCHMARK(std::string{label} + ": apply(ob, stream)") {
+    stream.str({});
+    object_repr<T>::apply(ob, stream);
+    return stream.tellp();
+  };
+
+  BENCHMARK(std::string{label} + ": repr_inline") { return repr_inline(ob).size(); };
+
+  BENCHMARK(std::string{label} + ": repr_arena, reset per call") {
+    std::size_t const size = arena.repr(ob).size();
+    arena.reset();
+    return size;
+  };
+}
+
+/// quoting for a large string, compared to `std::quoted`
+void bench_text(char const* label, std::string const& text) {
+  std::string buf{};
+  buf.reserve(text.size() * 4 + 64);
+  std::ostringstream stream{};
+
+  BENCHMARK(std::string{label} + ": repr_format_to, reused buffer") {
+    buf.clear();
+    repr_format_to(std::string_view{text}, std::back_inserter(buf));
+    return buf.size();
+  };
+
+  BENCHMARK(std::string{label} + ": stream << std::quoted(s)") {
+    stream.str(std::string{});
+    stream << std::quoted(text);
+    return stream.tellp();
+  };
+}
+
+/// a byte buffer in each format, without windowing, compared to `snprintf()`
+void bench_bytes(char const* label, std::vector<std::uint8_t> const& bytes) {
+  std::string buf{};
+  buf.reserve(bytes.size() * 5 + 256);
+
+  for (auto const& [name, format] : {std::pair{"hex", byte_format::hex},
+                                     std::pair{"hexdump", byte_format::hexdump},
+                                     std::pair{"base64", byte_format::base64}}) {
+    scoped_repr_limits const limits{{.bytes = format, .max_bytes = bytes.size()}};
+    BENCHMARK(std::string{label} + ": repr_format_to, " + name) {
+      buf.clear();
+      repr_format_to(bytes, std::back_inserter(buf));
+      return buf.size();
+    };
+  }
+
+  BENCHMARK(std::string{label} + ": snprintf(\"%02x\") per byte") {
+    buf.clear();
+    char digits[3];
+    for (std::uint8_t const b : bytes) {
+      std::snprintf(digits, sizeof(digits), "%02x", b);
+      buf.append(digits, 2);
+    }
+    return buf.size();
+  };
+}
+
+}  // namespace
+
+TEST_CASE("object_repr: scalars") {
+  bench_repr("int", -1234567890);
+  bench_repr("double", 3.14159265358979);
+  bench_repr("char32_t", U'±');
+}
+
+TEST_CASE("object_repr: text") {
+  bench_repr("std::string",
+             std::string{"field_name: value with \"quoted\" content, 0123456789abcdef"});
+  bench_repr("std::u16string", std::u16string{u"wide text content ±0123456789abcdef"});
+  bench_repr("char const*", static_cast<char const*>("a literal string"));
+}
+
+TEST_CASE("object_repr: large text") {
+  std::string text{};
+  while (text.size() < 64 * 1024) {
+    text.append("field_name: value with \"quoted\" content, 0123456789abcdef\n");
+  }
+  bench_text("64 KiB text", text);
+
+  // a binary payload, with each byte value
+  std::string payload(64 * 1024, '\0');
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<char>(i * 7);
+  }
+  bench_text("64 KiB binary", payload);
+}
+
+TEST_CASE("object_repr: wrappers") {
+  bench_repr("std::optional<std::string>", std::optional<std::string>{"field_name"});
+  bench_repr("std::optional<int>, empty", std::optional<int>{});
+  bench_repr("std::unique_ptr<long>", std::make_unique<long>(42));
+}
+
+TEST_CASE("object_repr: containers") {
+  bench_repr("std::vector<int>, 16 elements", std::vector<int>(16, 12345));
+  // truncated at the default element limit
+  bench_repr("std::vector<int>, 100k elements", std::vector<int>(100000, 12345));
+  bench_repr("std::vector<std::string>, 16 elements",
+             std::vector<std::string>(16, std::string{"field_value"}));
+}
+
+TEST_CASE("object_repr: byte buffers") {
+  std::vector<std::uint8_t> bytes(64 * 1024);
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    bytes[i] = static_cast<std::uint8_t>(i * 7);
+  }
+  bench_bytes("64 KiB", bytes);
+}
@@ -0,0 +1,89 @@
+// benchmarks for repr_format, compared with repr_string
+
+#include <iterator>
+#include <optional>
+#include <string>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/repr_format.hpp>
+
+using protowire::test::object_repr::repr_string;
+using protowire::test::repr_format::repr;
+using protowire::test::repr_format::repr_type;
+
+namespace {
+
+struct payloads {
+  std::string text{"field_name: value with \"quoted\" content, 0123456789abcdef"};
+  std::optional<std::string> opt_text{text};
+  std::u16string wide_text{u"wide text content ±0123456789abcdef"};
+  long number{-1234567890};
+};
+
+}  // namespace
+
+#if defined(__cpp_lib_format)
+
+TEST_CASE("repr_format: std::format") {
+  payloads const p{};
+  std::string buf{};
+  buf.reserve(1024);
+
+  BENCHMARK("std::format_to, repr") {
+    buf.clear();
+    std::format_to(std::back_inserter(buf), "{} {} {} {}", repr{p.text}, repr{p.opt_text},
+                   repr{p.wide_text}, repr{p.number});
+    return buf.size();
+  };
+
+  BENCHMARK("std::format_to, repr_string") {
+    buf.clear();
+    std::format_to(std::back_inserter(buf), "{} {} {} {}", repr_string(p.text),
+                   repr_string(p.opt_text), repr_string(p.wide_text),
+                   repr_string(p.number));
+    return buf.size();
+  };
+
+  BENCHMARK("std::format_to, repr_type") {
+    buf.clear();
+    std::format_to(std::back_inserter(buf), "{}",
+                   repr_type<std::optional<std::string>>{});
+    return buf.size();
+  };
+}
+
+#endif
+
+#if defined(PROTOWIRE_REPR_FMT)
+
+TEST_CASE("repr_format: fmt::format") {
+  payloads const p{};
+  std::string buf{};
+  buf.reserve(1024);
+
+  BENCHMARK("fmt::format_to, repr") {
+    buf.clear();
+    fmt::format_to(std::back_inserter(buf), "{} {} {} {}", repr{p.text}, repr{p.opt_text},
+                   repr{p.wide_text}, repr{p.number});
+    return buf.size();
+  };
+
+  BENCHMARK("fmt::format_to, repr_string") {
+    buf.clear();
+    fmt::format_to(std::back_inserter(buf), "{} {} {} {}", repr_string(p.text),
+                   repr_string(p.opt_text), repr_string(p.wide_text),
+                   repr_string(p.number));
+    return buf.size();
+  };
+
+  BENCHMARK("fmt::format_to, repr_type") {
+    buf.clear();
+    fmt::format_to(std::back_inserter(buf), "{}",
+                   repr_type<std::optional<std::string>>{});
+    return buf.size();
+  };
+}
+
+#endif
@@ -0,0 +1,89 @@
+// benchmarks for object_repr in concurrent threads
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/object_repr.hpp>
+
+using protowire::test::object_repr::repr_string;
+using protowire::test::object_repr::repr_write;
+
+namespace {
+
+constexpr int iterations = 2000;
+
+/// @brief thread counts from 1 to the hardware concurrency, doubling
+std::vector<unsigned> thread_counts() {
+  unsigned const max = std::max(2u, std::thread::hardware_concurrency());
+  std::vector<unsigned> counts{};
+  for (unsigned n = 1; n < max; n *= 2) {
+    counts.push_back(n);
+  }
+  counts.push_back(max);
+  return counts;
+}
+
+/// @brief run `func()` for `iterations` in each of `thread_count` threads
+///
+/// @return the total of the values returned
+template <typename F>
+std::size_t run_threads(unsigned thread_count, F const& func) {
+  std::vector<std::size_t> totals(thread_count);
+  std::vector<std::thread> threads{};
+  for (unsigned t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&func, &total = totals[t]] {
+      // accumulated locally, avoiding false sharing between the totals
+      std::size_t local = 0;
+      for (int i = 0; i < iterations; ++i) {
+        local += func();
+      }
+      total = local;
+    });
+  }
+  for (std::thread& th : threads) {
+    th.join();
+  }
+  std::size_t n = 0;
+  for (std::size_t const total : totals) {
+    n += total;
+  }
+  return n;
+}
+
+}  // namespace
+
+// each benchmark measures a fixed amount of work per thread, such that
+// a constant time for each thread count would be linear scaling
+
+TEST_CASE("object_repr: concurrent scaling") {
+  std::vector<std::string> const fields(32, std::string{"a field value, 0123456789"});
+  std::optional<long> const opt{-7};
+
+  for (unsigned const n : thread_counts()) {
+    std::string const threads = ", " + std::to_string(n) + " threads";
+
+    BENCHMARK("repr_string, std::vector<std::string>" + threads) {
+      return run_threads(n, [&fields] { return repr_string(fields).size(); });
+    };
+
+    BENCHMARK("repr_write, std::ostringstream per call" + threads) {
+      return run_threads(n, [&fields] {
+        std::ostringstream stream{};
+        repr_write(fields, stream);
+        return stream.str().size();
+      });
+    };
+
+    BENCHMARK("repr_string, std::optional<long>" + threads) {
+      return run_threads(n, [&opt] { return repr_string(opt).size(); });
+    };
+  }
+}
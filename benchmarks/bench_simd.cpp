@@ -0,0 +1,80 @@
+// benchmarks for the SIMD byte sequence kernels
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/check_str.hpp>
+#include <protowire/util/simd.hpp>
+
+namespace check_str = protowire::test::check_str;
+namespace simd = protowire::util::simd;
+
+namespace {
+
+void bench_equal(std::size_t n) {
+  std::vector<unsigned char> const a(n, 'x');
+  std::vector<unsigned char> const b(a);
+  std::string const label = std::to_string(n) + " bytes";
+
+  BENCHMARK(label + ": simd::equal") { return simd::equal(a.data(), b.data(), n); };
+
+  BENCHMARK(label + ": memcmp == 0") { return std::memcmp(a.data(), b.data(), n) == 0; };
+
+  BENCHMARK(label + ": simd::mismatch") { return simd::mismatch(a.data(), b.data(), n); };
+}
+
+void bench_find(std::size_t n) {
+  // a serialized buffer, with the needle at the end
+  std::string haystack{};
+  haystack.reserve(n);
+  while (haystack.size() + 32 < n) {
+    haystack.append("field_name: \"value\", ");
+  }
+  haystack.append("needle_field: 1");
+  std::string_view const needle{"needle_field"};
+  std::string const label = std::to_string(haystack.size()) + " bytes";
+
+  BENCHMARK(label + ": simd::find") {
+    return simd::find(haystack.data(), haystack.size(), needle.data(), needle.size());
+  };
+
+  BENCHMARK(label + ": std::string_view::find") {
+    return std::string_view{haystack}.find(needle);
+  };
+
+  BENCHMARK(label + ": std::string copy, std::string::find") {
+    std::string const copy = haystack;
+    return copy.find(needle);
+  };
+
+  BENCHMARK(label + ": str_find, 4 needles") {
+    return static_cast<bool>(check_str::str_find(haystack, needle, "field_name", "value",
+                                                 ": 1"));
+  };
+
+  BENCHMARK(label + ": std::string_view::find, 4 needles") {
+    std::string_view const h{haystack};
+    return h.find(needle) != h.npos && h.find("field_name") != h.npos
+           && h.find("value") != h.npos && h.find(": 1") != h.npos;
+  };
+}
+
+}  // namespace
+
+TEST_CASE("simd: equal sequences") {
+  bench_equal(7);
+  bench_equal(24);
+  bench_equal(100);
+  bench_equal(4096);
+}
+
+TEST_CASE("simd: substring search") {
+  bench_find(4096);
+  bench_find(4 * 1024 * 1024);
+}
@@ -0,0 +1,86 @@
+// benchmarks for tribool predicates and values
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <boost/logic/tribool.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/metatypes/tribool_p.hpp>
+#include <protowire/metatypes/tribool_vector.hpp>
+
+namespace metatypes = protowire::metatypes;
+namespace logic = boost::logic;
+
+namespace {
+
+std::array<logic::tribool, 3> const values{metatypes::false_value,
+                                            metatypes::indeterminate_value,
+                                            metatypes::true_value};
+
+template <typename T>
+int select_value() {
+  using selected = typename metatypes::if_indeterminate<T, metatypes::indeterminate_,
+                                                        metatypes::true_,
+                                                        metatypes::false_>::type;
+  return logic::indeterminate(selected::value) ? 0 : (selected::value ? 1 : -1);
+}
+
+}  // namespace
+
+TEST_CASE("tribool: runtime operations") {
+  BENCHMARK("tribool &&, ||, ! over all pairs") {
+    int n = 0;
+    for (logic::tribool const a : values) {
+      for (logic::tribool const b : values) {
+        n += static_cast<bool>(a && b) + static_cast<bool>(a || b)
+             + static_cast<bool>(!a);
+      }
+    }
+    return n;
+  };
+
+  BENCHMARK("tribool_ conversion") {
+    logic::tribool const t = metatypes::true_{};
+    logic::tribool const i = metatypes::indeterminate_{};
+    return static_cast<bool>(t) && logic::indeterminate(i);
+  };
+
+  BENCHMARK("if_indeterminate selection") {
+    return select_value<metatypes::true_>() + select_value<metatypes::false_>()
+           + select_value<metatypes::indeterminate_>();
+  };
+}
+
+TEST_CASE("tribool_vector: Kleene logic, 1M values") {
+  constexpr std::size_t n = 1 << 20;
+  metatypes::tribool_vector a(n);
+  metatypes::tribool_vector b(n);
+  std::vector<logic::tribool> va(n);
+  std::vector<logic::tribool> vb(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a.set(i, values[i % 3]);
+    b.set(i, values[(i / 3) % 3]);
+    va[i] = values[i % 3];
+    vb[i] = values[(i / 3) % 3];
+  }
+
+  BENCHMARK("tribool_vector &=") {
+    metatypes::tribool_vector c{a};
+    c &= b;
+    return c.count(metatypes::indeterminate_value);
+  };
+
+  BENCHMARK("std::vector<tribool>, &&") {
+    std::vector<logic::tribool> c{va};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      c[i] = c[i] && vb[i];
+      count += logic::indeterminate(c[i]);
+    }
+    return count;
+  };
+}
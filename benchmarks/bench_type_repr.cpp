@@ -0,0 +1,40 @@
+// benchmarks for type_repr
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/type_repr.hpp>
+
+using protowire::test::type_repr::type_repr;
+using protowire::util::type_name::type_name;
+
+TEST_CASE("type_repr: cold and warm") {
+  using value_t = std::optional<std::vector<int>> const*;
+  using repr_t = type_repr<value_t>;
+
+  // cold: compose the representation, as for the first call to apply().
+  // Inner representations are memoized after the first call.
+  BENCHMARK("cold: type_repr::build()") { return repr_t::build(); };
+
+  BENCHMARK("warm: type_repr::apply()") { return repr_t::apply(); };
+
+  BENCHMARK("warm: type_repr::apply(), copied") { return std::string{repr_t::apply()}; };
+}
+
+TEST_CASE("type_name: view and apply") {
+  using value_t = std::optional<std::vector<int>>;
+
+  BENCHMARK("type_name::view()") { return type_name<value_t>::view(); };
+
+  BENCHMARK("type_name::apply()") { return type_name<value_t>::apply(); };
+
+#if PROTOWIRE_TYPE_NAME_RTTI
+  BENCHMARK("boost::core::demangle") {
+    return boost::core::demangle(typeid(value_t).name());
+  };
+#endif
+}
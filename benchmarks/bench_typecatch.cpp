@@ -0,0 +1,58 @@
+// benchmarks for typecatch messages, on the pass path
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/test/typecatch.hpp>
+
+TEST_CASE("typecatch messages: passing assertions") {
+  std::vector<std::string> const fields{"id", "name", "email", "a longer field value"};
+  std::optional<long> const opt{-7};
+
+  BENCHMARK("CHECK, without messages") {
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("CAPTURE_REPR, CHECK") {
+    CAPTURE_REPR(fields);
+    CAPTURE_REPR(opt);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("LAZY_CAPTURE_REPR, CHECK") {
+    LAZY_CAPTURE_REPR(fields);
+    LAZY_CAPTURE_REPR(opt);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("RECORD_REPR, CHECK") {
+    RECORD_REPR(fields);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("LAZY_RECORD_REPR, CHECK") {
+    LAZY_RECORD_REPR(fields);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("RECORD_TYPE, CHECK") {
+    RECORD_TYPE(std::vector<std::string>);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+
+  BENCHMARK("LAZY_RECORD_TYPE, CHECK") {
+    LAZY_RECORD_TYPE(std::vector<std::string>);
+    CHECK(fields.size() == 4);
+    return fields.size();
+  };
+}
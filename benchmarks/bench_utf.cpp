@@ -0,0 +1,90 @@
+// benchmarks for UTF transcoding, with throughput in GB/s
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <protowire/util/utf.hpp>
+
+namespace utf = protowire::util::utf;
+
+namespace {
+
+constexpr std::size_t input_size = 1024 * 1024;
+
+template <typename CharT>
+std::basic_string<CharT> repeat(std::basic_string_view<CharT> s) {
+  std::basic_string<CharT> result{};
+  while (result.size() * sizeof(CharT) < input_size) {
+    result.append(s);
+  }
+  return result;
+}
+
+/// transcode with `utf::to_utf8()`, to a reused buffer
+template <typename CharT>
+std::size_t transcode(std::basic_string<CharT> const& s, std::string& buf) {
+  buf.clear();
+  utf::to_utf8(s.data(), s.size(), [&buf](std::string_view segment) {
+    buf.append(segment);
+  });
+  return buf.size();
+}
+
+/// transcode for each code point, as a baseline
+template <typename CharT>
+std::size_t transcode_scalar(std::basic_string<CharT> const& s, std::string& buf) {
+  buf.clear();
+  CharT const* p = s.data();
+  CharT const* const e = p + s.size();
+  char enc[4];
+  while (p != e) {
+    char32_t const c = utf::decode(p, e);
+    std::size_t const n = utf::encode_utf8(
+          (c == utf::invalid_code_point) ? utf::replacement_character : c, enc);
+    buf.append(enc, n);
+  }
+  return buf.size();
+}
+
+template <typename CharT>
+void bench_transcode(std::string const& label, std::basic_string_view<CharT> text) {
+  std::basic_string<CharT> const s = repeat(text);
+  std::string buf{};
+  buf.reserve(s.size() * 4);
+
+  BENCHMARK(label + ": to_utf8") { return transcode(s, buf); };
+
+  BENCHMARK(label + ": per code point") { return transcode_scalar(s, buf); };
+
+  // throughput, in bytes of input
+  constexpr int rounds = 50;
+  auto const start = std::chrono::steady_clock::now();
+  std::size_t total = 0;
+  for (int i = 0; i < rounds; ++i) {
+    total += transcode(s, buf);
+  }
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+  double const bytes = static_cast<double>(s.size() * sizeof(CharT)) * rounds;
+  std::cout << label << ": to_utf8 " << (bytes / elapsed.count() / 1e9) << " GB/s"
+            << " (" << total / rounds << " bytes)\n";
+}
+
+}  // namespace
+
+TEST_CASE("utf: ASCII text") {
+  bench_transcode<char8_t>("UTF-8 ASCII", u8"field_name: \"value\", ");
+  bench_transcode<char16_t>("UTF-16 ASCII", u"field_name: \"value\", ");
+  bench_transcode<char32_t>("UTF-32 ASCII", U"field_name: \"value\", ");
+}
+
+TEST_CASE("utf: mixed text") {
+  bench_transcode<char8_t>("UTF-8 mixed", u8"name: \"±4Å\", city: \"東京\", ");
+  bench_transcode<char16_t>("UTF-16 mixed", u"name: \"±4Å\", city: \"東京\", ");
+  bench_transcode<char32_t>("UTF-32 mixed", U"name: \"±4Å\", city: \"東京\", ");
+}
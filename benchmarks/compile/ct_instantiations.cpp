@@ -0,0 +1,92 @@
+// compile-time benchmark for the template instantiations in type_repr,
+// if_indeterminate, LString template arguments and object_repr
+//
+// Compile with CT_INSTANTIATION_COUNT distinct instantiations for each
+// workload (default: 64). Each workload is instantiated for a distinct
+// `tag<I>` or array size, such that none of the instantiations are
+// shared between workloads.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool_p.hpp>
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/type_repr.hpp>
+#include <protowire/util/lstring.hpp>
+
+namespace metatypes = protowire::metatypes;
+namespace lstring = protowire::util::lstring;
+
+using protowire::test::object_repr::repr_string;
+using protowire::test::type_repr::type_repr;
+
+#ifndef CT_INSTANTIATION_COUNT
+#define CT_INSTANTIATION_COUNT 64
+#endif
+
+template <std::size_t I>
+struct tag {};
+
+/// predicate type for each `I`, with a value of false, indeterminate or true
+template <std::size_t I>
+struct pred {
+  static constexpr boost::logic::tribool value = metatypes::detail::kleene_value(I % 3);
+};
+
+// type_repr: partial specializations for pointer, const and template types
+
+template <std::size_t I>
+using nested_t = std::optional<std::vector<std::pair<tag<I>, std::string>>> const*;
+
+template <std::size_t... I>
+std::size_t ct_type_repr(std::index_sequence<I...>) {
+  return (type_repr<nested_t<I>>::apply().size() + ...);
+}
+
+// if_indeterminate: type selection for each predicate
+
+template <std::size_t I>
+using selected_t =
+      typename metatypes::if_indeterminate<pred<I>, tag<0>, tag<1>, tag<2>>::type;
+
+template <std::size_t... I>
+constexpr std::size_t ct_if_indeterminate(std::index_sequence<I...>) {
+  return (std::is_same_v<selected_t<I>, tag<1>> + ...);
+}
+
+// LString: a distinct literal string template argument for each `I`
+
+template <std::size_t... I>
+constexpr std::uint64_t ct_lstring(std::index_sequence<I...>) {
+  return (lstring::lstring_hash_v<lstring::join<", ">(lstring::LString{"field"},
+                                                       lstring::to_lstring<I>())>
+          ^ ...);
+}
+
+// object_repr: requires-clauses for range, optional and tuple-like types
+
+template <std::size_t I>
+using repr_t =
+      std::pair<std::optional<std::array<long, I + 1>>, std::vector<std::string>>;
+
+template <std::size_t... I>
+std::size_t ct_object_repr(std::index_sequence<I...>) {
+  return (repr_string(repr_t<I>{}).size() + ...);
+}
+
+using seq = std::make_index_sequence<CT_INSTANTIATION_COUNT>;
+
+static_assert(ct_if_indeterminate(seq{}) == (CT_INSTANTIATION_COUNT + 1) / 3);
+static_assert(ct_lstring(seq{}) != 0);
+
+std::size_t ct_instantiations() {
+  return ct_type_repr(seq{}) + ct_object_repr(seq{});
+}
@@ -0,0 +1,55 @@
+// compile-time benchmark for the header and module builds, with a
+// workload representative of the tests under tests/
+//
+// Compile with -DCT_MODULES to import the protowire modules, or without,
+// to include the headers. See benchmarks/CMakeLists.txt
+
+#if defined(CT_MODULES)
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+import protowire.metatypes;
+import protowire.test;
+#else
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include <protowire/metatypes/tribool.hpp>
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/repr_arena.hpp>
+#include <protowire/test/type_repr.hpp>
+#include <protowire/util/lstring.hpp>
+#include <protowire/util/type_name.hpp>
+#endif
+
+namespace object_repr = protowire::test::object_repr;
+namespace type_repr = protowire::test::type_repr;
+
+std::size_t ct_modules() {
+  std::size_t n = 0;
+  n += object_repr::repr_string(std::string{"a"}).size();
+  n += object_repr::repr_string(std::u16string{u"a"}).size();
+  n += object_repr::repr_string(std::optional<int>{1}).size();
+  n += object_repr::repr_string(std::vector<int>{1, 2, 3}).size();
+  n += object_repr::repr_string(std::map<int, std::string>{{1, "a"}}).size();
+  n += object_repr::repr_string(std::tuple<int, char, double>{1, 'a', 1.5}).size();
+  n += object_repr::repr_string(std::variant<int, std::string>{"a"}).size();
+  n += object_repr::repr_inline(std::pair<int, int>{1, 2}).size();
+  n += type_repr::type_repr<std::vector<std::optional<int>> const*>::apply().size();
+  n += protowire::util::type_name::type_name<std::map<int, long>>::view().size();
+  constexpr protowire::util::lstring::LString name{"field_name"};
+  n += name.view().size();
+  constexpr protowire::metatypes::tribool t{true};
+  n += (t && protowire::metatypes::tribool{false}) ? 0 : 1;
+  return n;
+}
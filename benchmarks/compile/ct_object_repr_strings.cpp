@@ -0,0 +1,41 @@
+// compile-time benchmark for object_repr of string, character and
+// optional types
+//
+// Compile with -DPROTOWIRE_UTIL_LIBRARY, for the explicit instantiation
+// declarations used with the protowire_util library, or without, for
+// header-only use. With the library, these specializations are not
+// instantiated here.
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <protowire/test/object_repr.hpp>
+
+using protowire::test::object_repr::repr_string;
+
+std::size_t ct_object_repr_strings() {
+  std::size_t n = 0;
+  n += repr_string(std::string{"a"}).size();
+  n += repr_string(std::wstring{L"a"}).size();
+  n += repr_string(std::u8string{u8"a"}).size();
+  n += repr_string(std::u16string{u"a"}).size();
+  n += repr_string(std::u32string{U"a"}).size();
+  n += repr_string(std::string_view{"a"}).size();
+  n += repr_string(std::wstring_view{L"a"}).size();
+  n += repr_string(std::u8string_view{u8"a"}).size();
+  n += repr_string(std::u16string_view{u"a"}).size();
+  n += repr_string(std::u32string_view{U"a"}).size();
+  n += repr_string('a').size();
+  n += repr_string(L'a').size();
+  n += repr_string(u8'a').size();
+  n += repr_string(u'a').size();
+  n += repr_string(U'a').size();
+  n += repr_string(std::optional<int>{1}).size();
+  n += repr_string(std::optional<long>{1}).size();
+  n += repr_string(std::optional<unsigned>{1}).size();
+  n += repr_string(std::optional<double>{1}).size();
+  n += repr_string(std::optional<std::string>{"a"}).size();
+  return n;
+}
@@ -0,0 +1,79 @@
+// compile-time benchmark for tribool folds, over packs of 1000 predicates
+//
+// Compile with one of:
+//
+//  -DCT_TRIBOOL_FOLD       tribool_and, tribool_or and tribool_all_known
+//  -DCT_TRIBOOL_RECURSIVE  a recursive, one predicate per instantiation
+//                          fold, for comparison
+//
+// Each predicate is a distinct type. For a short-circuit result, only
+// the first block of predicates should be instantiated.
+
+#include <cstddef>
+#include <utility>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool_p.hpp>
+
+namespace metatypes = protowire::metatypes;
+namespace logic = boost::logic;
+
+#ifndef CT_TRIBOOL_PACK_SIZE
+#define CT_TRIBOOL_PACK_SIZE 1000
+#endif
+
+/// distinct predicate type for each `I`, with the value `V`
+template <std::size_t I, int V>
+struct pred {
+  static constexpr logic::tribool value = metatypes::detail::kleene_value(V);
+};
+
+#if defined(CT_TRIBOOL_RECURSIVE)
+
+template <typename... Ps>
+struct recursive_and : metatypes::true_ {};
+
+namespace detail = metatypes::detail;
+
+template <typename P, typename... Rest>
+struct recursive_and<P, Rest...>
+    : metatypes::tribool_<detail::kleene_value(detail::kleene_and_op::combine(
+            detail::kleene_code(P::value),
+            detail::kleene_code(recursive_and<Rest...>::value)))> {};
+
+template <std::size_t Salt, typename Seq>
+struct bench;
+
+template <std::size_t Salt, std::size_t... I>
+struct bench<Salt, std::index_sequence<I...>> {
+  static constexpr bool all_true = recursive_and<pred<I + Salt, 2>...>::value.value
+                                   == logic::tribool::true_value;
+  static constexpr bool early_false =
+        recursive_and<pred<Salt, 0>, pred<I + Salt + 1, 2>...>::value.value
+        == logic::tribool::false_value;
+};
+
+#else
+
+template <std::size_t Salt, typename Seq>
+struct bench;
+
+template <std::size_t Salt, std::size_t... I>
+struct bench<Salt, std::index_sequence<I...>> {
+  static constexpr bool all_true =
+        metatypes::tribool_and<pred<I + Salt, 2>...>::value.value
+        == logic::tribool::true_value;
+  static constexpr bool early_false =
+        metatypes::tribool_and<pred<Salt, 0>, pred<I + Salt + 1, 2>...>::value.value
+        == logic::tribool::false_value;
+};
+
+#endif
+
+using seq = std::make_index_sequence<CT_TRIBOOL_PACK_SIZE>;
+
+static_assert(bench<0, seq>::all_true);
+static_assert(bench<0, seq>::early_false);
+static_assert(bench<100000, seq>::all_true);
+static_assert(bench<200000, seq>::early_false);
@@ -0,0 +1,29 @@
+
+include(${CMAKE_CURRENT_LIST_DIR}/add_object.cmake)
+
+function(add_catch_benchmark bench_name)
+    set(_options)
+    set(_single_value)
+    set(_multi_value PRIVATE PRIVATE_INCLUDE SYSTEM_PRIVATE SOURCES)
+    cmake_parse_arguments(PARSE_ARGV 1 opt "${_options}" "${_single_value}" "${_multi_value}")
+
+    if(NOT DEFINED opt_SOURCES)
+        set(opt_SOURCES ${bench_name}.cpp)
+    endif()
+
+    foreach(flag ${_multi_value})
+        if(NOT DEFINED opt_${flag})
+            set(opt_${flag})
+        endif()
+    endforeach()
+
+    add_object(${bench_name} EXEC
+        ${opt_SOURCES}
+        ${opt_UNPARSED_ARGUMENTS}
+        PRIVATE ${opt_PRIVATE}
+        PRIVATE_INCLUDE ${opt_PRIVATE_INCLUDE}
+        SYSTEM_PRIVATE ${opt_SYSTEM_PRIVATE} Catch2::Catch2WithMain
+    )
+
+    set_property(GLOBAL APPEND PROPERTY PROTOWIRE_UTIL_BENCHMARK_TARGETS ${bench_name})
+endfunction()
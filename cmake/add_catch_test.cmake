@@ -1,10 +1,23 @@
-
 include(${CMAKE_CURRENT_LIST_DIR}/add_object.cmake)
 
+## add_catch_test(<name> [CUSTOM_MAIN] [NO_UNITY] [SOURCES ...] [DEFINITIONS ...]
+##     [PRIVATE ...] [PRIVATE_INCLUDE ...] [SYSTEM_PRIVATE ...])
+##
+## defines a test executable <name>, with tests discovered by
+## catch_discover_tests()
+##
+## if PROTOWIRE_UTIL_TEST_PCH_TARGET is set, the test will reuse the
+## precompiled header of that target
+##
+## if PROTOWIRE_UTIL_TEST_UNITY is true, a test without CUSTOM_MAIN or
+## NO_UNITY is not defined as an executable. The sources and libraries for
+## the test are registered for add_catch_test_runner(). NO_UNITY is for a
+## test that cannot share an executable, e.g one replacing operator new
+
 function(add_catch_test test_name)
-    set(_options CUSTOM_MAIN)
+    set(_options CUSTOM_MAIN NO_UNITY)
     set(_single_value)
-    set(_multi_value PRIVATE PRIVATE_INCLUDE SYSTEM_PRIVATE SOURCES)
+    set(_multi_value PRIVATE PRIVATE_INCLUDE SYSTEM_PRIVATE SOURCES DEFINITIONS)
     cmake_parse_arguments(PARSE_ARGV 1 opt "${_options}" "${_single_value}" "${_multi_value}")
 
     if(NOT DEFINED opt_SOURCES)
@@ -29,13 +42,91 @@ function(add_catch_test test_name)
         endif()
     endforeach()
 
+    if(PROTOWIRE_UTIL_TEST_UNITY AND NOT ${opt_CUSTOM_MAIN}
+            AND NOT ${opt_NO_UNITY})
+        set(_sources)
+        foreach(_source ${opt_SOURCES} ${opt_UNPARSED_ARGUMENTS})
+            cmake_path(ABSOLUTE_PATH _source NORMALIZE OUTPUT_VARIABLE _source)
+            list(APPEND _sources ${_source})
+        endforeach()
+        set_property(GLOBAL APPEND PROPERTY PROTOWIRE_UTIL_UNITY_TESTS ${test_name})
+        set_property(GLOBAL PROPERTY
+            PROTOWIRE_UTIL_UNITY_TEST_${test_name}_SOURCES ${_sources})
+        set_property(GLOBAL PROPERTY
+            PROTOWIRE_UTIL_UNITY_TEST_${test_name}_DEFINITIONS ${opt_DEFINITIONS})
+        set_property(GLOBAL APPEND PROPERTY PROTOWIRE_UTIL_UNITY_PRIVATE
+            ${opt_PRIVATE})
+        set_property(GLOBAL APPEND PROPERTY PROTOWIRE_UTIL_UNITY_PRIVATE_INCLUDE
+            ${opt_PRIVATE_INCLUDE} ${_test_includes})
+        set_property(GLOBAL APPEND PROPERTY PROTOWIRE_UTIL_UNITY_SYSTEM_PRIVATE
+            ${opt_SYSTEM_PRIVATE})
+        return()
+    endif()
+
+    if(PROTOWIRE_UTIL_TEST_PCH_TARGET)
+        set(_pch PCH_FROM ${PROTOWIRE_UTIL_TEST_PCH_TARGET})
+    else()
+        set(_pch)
+    endif()
+
     add_object(${test_name} EXEC
         ${opt_SOURCES}
         ${opt_UNPARSED_ARGUMENTS}
+        ${_pch}
         PRIVATE ${opt_PRIVATE} protowire_test_libs
         PRIVATE_INCLUDE  ${opt_PRIVATE_INCLUDE} ${_test_includes}
         SYSTEM_PRIVATE ${opt_SYSTEM_PRIVATE} ${_catch2_target}
     )
+    target_compile_definitions(${test_name} PRIVATE ${opt_DEFINITIONS})
 
     catch_discover_tests(${test_name})
 endfunction()
+
+## add_catch_test_runner(<name>)
+##
+## defines a unity build test executable <name>, for each test registered
+## with add_catch_test() under PROTOWIRE_UTIL_TEST_UNITY
+##
+## sources of a test with DEFINITIONS are compiled separately from the
+## unity sources. The imported targets linked with each test must be
+## available in the directory calling this function
+
+function(add_catch_test_runner runner_name)
+    get_property(_tests GLOBAL PROPERTY PROTOWIRE_UTIL_UNITY_TESTS)
+    get_property(_private GLOBAL PROPERTY PROTOWIRE_UTIL_UNITY_PRIVATE)
+    get_property(_private_include GLOBAL PROPERTY PROTOWIRE_UTIL_UNITY_PRIVATE_INCLUDE)
+    get_property(_system_private GLOBAL PROPERTY PROTOWIRE_UTIL_UNITY_SYSTEM_PRIVATE)
+    list(REMOVE_DUPLICATES _private)
+    list(REMOVE_DUPLICATES _private_include)
+    list(REMOVE_DUPLICATES _system_private)
+
+    set(_sources)
+    foreach(_test ${_tests})
+        get_property(_test_sources GLOBAL
+            PROPERTY PROTOWIRE_UTIL_UNITY_TEST_${_test}_SOURCES)
+        get_property(_test_definitions GLOBAL
+            PROPERTY PROTOWIRE_UTIL_UNITY_TEST_${_test}_DEFINITIONS)
+        if(_test_definitions)
+            set_source_files_properties(${_test_sources} PROPERTIES
+                COMPILE_DEFINITIONS "${_test_definitions}")
+        endif()
+        list(APPEND _sources ${_test_sources})
+    endforeach()
+
+    if(PROTOWIRE_UTIL_TEST_PCH_TARGET)
+        set(_pch PCH_FROM ${PROTOWIRE_UTIL_TEST_PCH_TARGET})
+    else()
+        set(_pch)
+    endif()
+
+    add_object(${runner_name} EXEC
+        ${_sources}
+        ${_pch}
+        PRIVATE ${_private} protowire_test_libs
+        PRIVATE_INCLUDE ${_private_include}
+        SYSTEM_PRIVATE ${_system_private} Catch2::Catch2WithMain
+    )
+    set_target_properties(${runner_name} PROPERTIES UNITY_BUILD ON)
+
+    catch_discover_tests(${runner_name})
+endfunction()
@@ -0,0 +1,149 @@
+## compile-time benchmarks
+##
+## add_compile_benchmark(<name> SOURCE <file>
+##     [BUDGET <ms>] [TEMPLATE_BUDGET <ms>]
+##     [DEFINITIONS ...] [OPTIONS ...] [PRIVATE ...])
+##
+## defines an object library <name> for <file>, excluded from the default
+## build, and registers <name> for the run_compile_benchmarks target. The
+## benchmark compile will use the include directories, definitions and
+## compile options of <name>
+##
+## with BUDGET or TEMPLATE_BUDGET, <name> is also registered for the
+## check_compile_budgets target. BUDGET is the budget for the compile and
+## TEMPLATE_BUDGET the budget for the instantiations of each template, in
+## milliseconds
+
+function(add_compile_benchmark bench_name)
+    set(_options)
+    set(_single_value SOURCE BUDGET TEMPLATE_BUDGET)
+    set(_multi_value DEFINITIONS OPTIONS PRIVATE)
+    cmake_parse_arguments(PARSE_ARGV 1 opt
+        "${_options}" "${_single_value}" "${_multi_value}")
+
+    add_library(${bench_name} OBJECT EXCLUDE_FROM_ALL ${opt_SOURCE})
+    target_include_directories(${bench_name} PRIVATE ${PROJECT_SOURCE_DIR}/include)
+    target_compile_definitions(${bench_name} PRIVATE ${opt_DEFINITIONS})
+    target_compile_options(${bench_name} PRIVATE ${opt_OPTIONS})
+    target_link_libraries(${bench_name} PRIVATE ${opt_PRIVATE})
+    set_target_properties(${bench_name} PROPERTIES
+        PROTOWIRE_COMPILE_BENCHMARK_SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/${opt_SOURCE})
+
+    set_property(GLOBAL APPEND
+        PROPERTY PROTOWIRE_UTIL_COMPILE_BENCHMARK_TARGETS ${bench_name})
+
+    if(DEFINED opt_BUDGET OR DEFINED opt_TEMPLATE_BUDGET)
+        foreach(_budget BUDGET TEMPLATE_BUDGET)
+            if(NOT DEFINED opt_${_budget})
+                set(opt_${_budget} 0)
+            endif()
+        endforeach()
+        set_target_properties(${bench_name} PROPERTIES
+            PROTOWIRE_COMPILE_BUDGET ${opt_BUDGET}
+            PROTOWIRE_COMPILE_TEMPLATE_BUDGET ${opt_TEMPLATE_BUDGET})
+        set_property(GLOBAL APPEND
+            PROPERTY PROTOWIRE_UTIL_COMPILE_BUDGET_TARGETS ${bench_name})
+    endif()
+endfunction()
+
+## add the run_compile_benchmarks target, for each registered compile benchmark
+##
+## each source is compiled with -fsyntax-only and -ftime-report, timed
+## with `cmake -E time`. This is available for GCC and Clang
+function(add_compile_benchmark_target)
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        message(STATUS
+            "run_compile_benchmarks is not available for ${CMAKE_CXX_COMPILER_ID}")
+        return()
+    endif()
+
+    get_property(_benchmarks GLOBAL
+        PROPERTY PROTOWIRE_UTIL_COMPILE_BENCHMARK_TARGETS)
+    set(_commands)
+    foreach(_bench ${_benchmarks})
+        get_target_property(_source ${_bench} PROTOWIRE_COMPILE_BENCHMARK_SOURCE)
+        set(_includes "$<TARGET_PROPERTY:${_bench},INCLUDE_DIRECTORIES>")
+        set(_definitions "$<TARGET_PROPERTY:${_bench},COMPILE_DEFINITIONS>")
+        list(APPEND _commands
+            COMMAND ${CMAKE_COMMAND} -E echo "-- compile benchmark: ${_bench}"
+            COMMAND ${CMAKE_COMMAND} -E time
+                ${CMAKE_CXX_COMPILER} -std=c++${CMAKE_CXX_STANDARD}
+                -fsyntax-only -ftime-report
+                "$<$<BOOL:${_includes}>:-I$<JOIN:${_includes},$<SEMICOLON>-I>>"
+                "$<$<BOOL:${_definitions}>:-D$<JOIN:${_definitions},$<SEMICOLON>-D>>"
+                "$<TARGET_PROPERTY:${_bench},COMPILE_OPTIONS>"
+                ${_source}
+        )
+    endforeach()
+
+    add_custom_target(run_compile_benchmarks
+        ${_commands}
+        COMMAND_EXPAND_LISTS
+        VERBATIM
+        USES_TERMINAL
+    )
+endfunction()
+
+## add_compile_budget_target(RESULTS <dir> [PERCENT <n>])
+##
+## add the check_compile_budgets target, for each compile benchmark with
+## a budget. Each source is compiled with -ftime-trace for Clang, or with
+## -ftime-report for GCC, and instantiation times are aggregated in
+## <dir>/compile_budgets.txt by compile_budget_report.cmake. The target
+## fails if any budget is exceeded.
+##
+## PERCENT scales each budget, e.g 200 for a build host at half the speed
+## of the host used for the budgets (default: 100)
+function(add_compile_budget_target)
+    set(_options)
+    set(_single_value RESULTS PERCENT)
+    set(_multi_value)
+    cmake_parse_arguments(PARSE_ARGV 0 opt
+        "${_options}" "${_single_value}" "${_multi_value}")
+
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        message(STATUS
+            "check_compile_budgets is not available for ${CMAKE_CXX_COMPILER_ID}")
+        return()
+    endif()
+
+    if(NOT DEFINED opt_PERCENT)
+        set(opt_PERCENT 100)
+    endif()
+
+    get_property(_benchmarks GLOBAL
+        PROPERTY PROTOWIRE_UTIL_COMPILE_BUDGET_TARGETS)
+    set(_budget_dir ${CMAKE_CURRENT_BINARY_DIR}/compile_budgets)
+    set(_files)
+    foreach(_bench ${_benchmarks})
+        get_target_property(_source ${_bench} PROTOWIRE_COMPILE_BENCHMARK_SOURCE)
+        get_target_property(_budget ${_bench} PROTOWIRE_COMPILE_BUDGET)
+        get_target_property(_template_budget ${_bench} PROTOWIRE_COMPILE_TEMPLATE_BUDGET)
+        set(_includes "$<TARGET_PROPERTY:${_bench},INCLUDE_DIRECTORIES>")
+        set(_definitions "$<TARGET_PROPERTY:${_bench},COMPILE_DEFINITIONS>")
+        file(GENERATE OUTPUT ${_budget_dir}/${_bench}.cmake CONTENT
+"set(BENCH_NAME ${_bench})
+set(BENCH_COMPILER [[${CMAKE_CXX_COMPILER}]])
+set(BENCH_COMPILER_ID ${CMAKE_CXX_COMPILER_ID})
+set(BENCH_ARGS -std=c++${CMAKE_CXX_STANDARD}
+    \"$<$<BOOL:${_includes}>:-I$<JOIN:${_includes},$<SEMICOLON>-I>>\"
+    \"$<$<BOOL:${_definitions}>:-D$<JOIN:${_definitions},$<SEMICOLON>-D>>\"
+    \"$<TARGET_PROPERTY:${_bench},COMPILE_OPTIONS>\")
+set(BENCH_SOURCE [[${_source}]])
+set(BENCH_BUDGET ${_budget})
+set(BENCH_TEMPLATE_BUDGET ${_template_budget})
+")
+        list(APPEND _files ${_budget_dir}/${_bench}.cmake)
+    endforeach()
+    file(WRITE ${_budget_dir}/budgets.cmake "set(COMPILE_BUDGET_FILES \"${_files}\")\n")
+
+    add_custom_target(check_compile_budgets
+        COMMAND ${CMAKE_COMMAND}
+            -DBUDGET_LIST=${_budget_dir}/budgets.cmake
+            -DOUTPUT_DIR=${opt_RESULTS}
+            -DBUDGET_PERCENT=${opt_PERCENT}
+            -P ${PROJECT_SOURCE_DIR}/cmake/compile_budget_report.cmake
+        VERBATIM
+        USES_TERMINAL
+    )
+endfunction()
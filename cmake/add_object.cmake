@@ -17,8 +17,8 @@ endmacro()
 function(add_object NAME)
     set(_library_options STATIC SHARED MODULE OBJECT INTERFACE)
     set(_exec_options WIN32 MACOSX_BUNDLE)
-    set(_single_value ALIAS)
-    set(_multi_value PRIVATE PUBLIC SYSTEM_PRIVATE SYSTEM_PUBLIC PRIVATE_INCLUDE PUBLIC_INCLUDE)
+    set(_single_value ALIAS PCH_FROM)
+    set(_multi_value PRIVATE PUBLIC SYSTEM_PRIVATE SYSTEM_PUBLIC PRIVATE_INCLUDE PUBLIC_INCLUDE PCH)
     set(_options LIBRARY EXEC NOT_GLOBAL EXCLUDE_FROM_ALL ${_library_options} ${_exec_options})
     cmake_parse_arguments(PARSE_ARGV 1 opt "${_options}" "${_single_value}" "${_multi_value}")
 
@@ -90,11 +90,25 @@ function(add_object NAME)
         target_include_directories(${NAME} PRIVATE
             ${PROJECT_SOURCE_DIR}/source ## object includes
         )
-        target_compile_definitions(${NAME} PRIVATE
-            "_OBJECT_NAME=$<TARGET_PROPERTY:${NAME},NAME>"
-            "_OBJECT_BINARY_DIR=${CMAKE_CURRENT_BINARY_DIR}"
-            "_OBJECT_SOURCE_DIR=${CMAKE_CURRENT_SOURCE_DIR}"
-        )
+        if(NOT DEFINED opt_PCH AND NOT DEFINED opt_PCH_FROM)
+            ## not defined for objects sharing a precompiled header, where
+            ## the definitions would differ from those of the header
+            target_compile_definitions(${NAME} PRIVATE
+                "_OBJECT_NAME=$<TARGET_PROPERTY:${NAME},NAME>"
+                "_OBJECT_BINARY_DIR=${CMAKE_CURRENT_BINARY_DIR}"
+                "_OBJECT_SOURCE_DIR=${CMAKE_CURRENT_SOURCE_DIR}"
+            )
+        endif()
+    elseif(DEFINED opt_PCH OR DEFINED opt_PCH_FROM)
+        message(FATAL_ERROR "add_object(${NAME} ...): Option not supported for alias: PCH, PCH_FROM")
+    endif()
+
+    if(DEFINED opt_PCH AND DEFINED opt_PCH_FROM)
+        message(FATAL_ERROR "add_object(${NAME} ...): Must be called with at most one of PCH or PCH_FROM")
+    elseif(DEFINED opt_PCH)
+        target_precompile_headers(${NAME} PRIVATE ${opt_PCH})
+    elseif(DEFINED opt_PCH_FROM)
+        target_precompile_headers(${NAME} REUSE_FROM ${opt_PCH_FROM})
     endif()
 
     if(DEFINED opt_PRIVATE)
@@ -0,0 +1,264 @@
+## compile-time budget report, in script mode
+##
+## cmake -DBUDGET_LIST=<file> -DOUTPUT_DIR=<dir> [-DREPORT_LIMIT=<n>]
+##     [-DBUDGET_PERCENT=<n>] [-DTRACE_GRANULARITY=<us>]
+##     -P compile_budget_report.cmake
+##
+## BUDGET_LIST is generated in add_compile_budget_target(), setting
+## COMPILE_BUDGET_FILES. Each file in COMPILE_BUDGET_FILES sets the
+## following, for one compile benchmark:
+##
+##   BENCH_NAME               benchmark name
+##   BENCH_COMPILER           compiler path
+##   BENCH_COMPILER_ID        CMAKE_CXX_COMPILER_ID
+##   BENCH_ARGS               compiler arguments, excepting the source file
+##   BENCH_SOURCE             source file
+##   BENCH_BUDGET             budget for the compile, in milliseconds
+##   BENCH_TEMPLATE_BUDGET    budget for each template, in milliseconds
+##
+## With Clang, each source is compiled with -ftime-trace. Instantiation
+## times are aggregated for each template, from the InstantiateClass and
+## InstantiateFunction events in the trace. Each time is inclusive of
+## any nested instantiation.
+##
+## GCC does not report times for each template. Each source is compiled
+## with -ftime-report, and the template budget is applied to the time
+## for template instantiation, constraint normalization and satisfaction,
+## and constant expression evaluation, each in total.
+##
+## The report is written to OUTPUT_DIR/compile_budgets.txt. The script
+## fails if any budget is exceeded, after all benchmarks are compiled.
+
+cmake_minimum_required(VERSION 3.20)
+
+if(NOT DEFINED REPORT_LIMIT)
+    set(REPORT_LIMIT 20)
+endif()
+
+if(NOT DEFINED BUDGET_PERCENT)
+    set(BUDGET_PERCENT 100)
+endif()
+
+if(NOT DEFINED TRACE_GRANULARITY)
+    set(TRACE_GRANULARITY 100)
+endif()
+
+## `seconds`, e.g "1.25", as an integer number of microseconds
+function(_budget_seconds_to_us seconds out_var)
+    if(NOT seconds MATCHES "^([0-9]+)(\\.([0-9]*))?$")
+        message(FATAL_ERROR "Not a number of seconds: ${seconds}")
+    endif()
+    set(_whole ${CMAKE_MATCH_1})
+    set(_fraction "${CMAKE_MATCH_3}000000")
+    string(SUBSTRING "${_fraction}" 0 6 _fraction)
+    # without leading zeros
+    string(REGEX MATCH "^0*([0-9]+)$" _fraction "${_fraction}")
+    math(EXPR _us "${_whole} * 1000000 + ${CMAKE_MATCH_1}")
+    set(${out_var} ${_us} PARENT_SCOPE)
+endfunction()
+
+## `us` microseconds, formatted as milliseconds with one decimal place
+function(_budget_format_ms us out_var)
+    math(EXPR _ms "${us} / 1000")
+    math(EXPR _tenths "(${us} % 1000) / 100")
+    set(_text "${_ms}.${_tenths} ms")
+    string(LENGTH "${_text}" _length)
+    if(_length LESS 12)
+        math(EXPR _pad "12 - ${_length}")
+        string(REPEAT " " ${_pad} _padding)
+        set(_text "${_padding}${_text}")
+    endif()
+    set(${out_var} "${_text}" PARENT_SCOPE)
+endfunction()
+
+## add `us` microseconds to the entry `label`, with the entry kind `kind`
+##
+## entries of the kind TEMPLATE are checked against BENCH_TEMPLATE_BUDGET
+macro(_budget_add kind label us)
+    string(MD5 _key "${label}")
+    if(NOT DEFINED _entry_us_${_key})
+        list(APPEND _entries ${_key})
+        set(_entry_label_${_key} "${label}")
+        set(_entry_kind_${_key} ${kind})
+        set(_entry_us_${_key} 0)
+        set(_entry_count_${_key} 0)
+    endif()
+    math(EXPR _entry_us_${_key} "${_entry_us_${_key}} + ${us}")
+    math(EXPR _entry_count_${_key} "${_entry_count_${_key}} + 1")
+endmacro()
+
+macro(_budget_report line)
+    message(STATUS "${line}")
+    string(APPEND _report "${line}\n")
+endmacro()
+
+## compile BENCH_SOURCE with -ftime-trace, adding entries from the trace
+macro(_budget_clang_trace)
+    set(_object ${OUTPUT_DIR}/${BENCH_NAME}.o)
+    set(_trace ${OUTPUT_DIR}/${BENCH_NAME}.json)
+    execute_process(
+        COMMAND ${BENCH_COMPILER} ${BENCH_ARGS}
+            -ftime-trace -ftime-trace-granularity=${TRACE_GRANULARITY}
+            -c -o ${_object} ${BENCH_SOURCE}
+        RESULT_VARIABLE _result
+        ERROR_VARIABLE _output
+    )
+    if(NOT _result EQUAL 0)
+        message(FATAL_ERROR "${BENCH_NAME}: compile failed\n${_output}")
+    endif()
+
+    file(READ ${_trace} _json)
+    # JSON strings in the trace, e.g template arguments, may contain
+    # list separators and brackets
+    string(REPLACE ";" "\\;" _json "${_json}")
+    string(REPLACE "[" "(" _json "${_json}")
+    string(REPLACE "]" ")" _json "${_json}")
+
+    set(_detail "\"detail\":\"((\\\\.|[^\"\\\\])*)\"")
+    string(REGEX MATCHALL
+        "\"dur\":[0-9]+,\"name\":\"Instantiate(Class|Function)\",\"args\":{${_detail}"
+        _events "${_json}")
+    foreach(_event IN LISTS _events)
+        string(REGEX MATCH "^\"dur\":([0-9]+),.*${_detail}" _ignored "${_event}")
+        set(_dur ${CMAKE_MATCH_1})
+        # aggregate each instantiation under the template name
+        string(REGEX REPLACE "<.*$" "" _name "${CMAKE_MATCH_2}")
+        string(REPLACE "\\" "" _name "${_name}")
+        string(REPLACE "\"" "'" _name "${_name}")
+        _budget_add(TEMPLATE "${_name}" ${_dur})
+    endforeach()
+
+    string(REGEX MATCHALL "\"dur\":[0-9]+,\"name\":\"Total [A-Za-z]+\"" _totals "${_json}")
+    foreach(_event IN LISTS _totals)
+        string(REGEX MATCH "^\"dur\":([0-9]+),\"name\":\"(Total [A-Za-z]+)\"" _ignored "${_event}")
+        set(_dur ${CMAKE_MATCH_1})
+        set(_name "${CMAKE_MATCH_2}")
+        if(_name STREQUAL "Total ExecuteCompiler")
+            set(_total_us ${_dur})
+        elseif(_name MATCHES "Instantiat|Frontend|Source|ParseClass")
+            _budget_add(TOTAL "${_name}" ${_dur})
+        endif()
+    endforeach()
+endmacro()
+
+## compile BENCH_SOURCE with -ftime-report, adding entries from the report
+macro(_budget_gcc_report)
+    execute_process(
+        COMMAND ${BENCH_COMPILER} ${BENCH_ARGS} -fsyntax-only -ftime-report ${BENCH_SOURCE}
+        RESULT_VARIABLE _result
+        ERROR_VARIABLE _output
+    )
+    if(NOT _result EQUAL 0)
+        message(FATAL_ERROR "${BENCH_NAME}: compile failed\n${_output}")
+    endif()
+
+    # each line: name, then usr, sys and wall times in seconds, then GGC memory
+    set(_number "([0-9.]+) +(\\( *[0-9]+%\\))?")
+    set(_line_regex "^ ([^:]*[^ :]) +: +${_number} +${_number} +${_number}")
+    string(REPLACE "\n" ";" _lines "${_output}")
+    foreach(_line IN LISTS _lines)
+        if(NOT _line MATCHES "${_line_regex}")
+            continue()
+        endif()
+        set(_name "${CMAKE_MATCH_1}")
+        _budget_seconds_to_us(${CMAKE_MATCH_6} _wall_us)
+        if(_name STREQUAL "TOTAL")
+            set(_total_us ${_wall_us})
+        elseif(_name MATCHES "^(template instantiation|constraint|constant expression)")
+            _budget_add(TEMPLATE "${_name}" ${_wall_us})
+        else()
+            _budget_add(TOTAL "${_name}" ${_wall_us})
+        endif()
+    endforeach()
+endmacro()
+
+if(NOT DEFINED BUDGET_LIST OR NOT DEFINED OUTPUT_DIR)
+    message(FATAL_ERROR "compile_budget_report.cmake: BUDGET_LIST and OUTPUT_DIR are required")
+endif()
+
+include(${BUDGET_LIST})
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(_report)
+set(_failures)
+foreach(_file IN LISTS COMPILE_BUDGET_FILES)
+    include(${_file})
+    math(EXPR _budget_us "${BENCH_BUDGET} * ${BUDGET_PERCENT} * 10")
+    math(EXPR _template_budget_us "${BENCH_TEMPLATE_BUDGET} * ${BUDGET_PERCENT} * 10")
+
+    if(_entries)
+        foreach(_key IN LISTS _entries)
+            unset(_entry_us_${_key})
+        endforeach()
+    endif()
+    set(_entries)
+    set(_total_us 0)
+
+    if(BENCH_COMPILER_ID MATCHES "Clang")
+        _budget_clang_trace()
+    else()
+        _budget_gcc_report()
+    endif()
+
+    _budget_format_ms(${_total_us} _total_text)
+    _budget_format_ms(${_budget_us} _budget_text)
+    _budget_format_ms(${_template_budget_us} _template_budget_text)
+    string(STRIP "${_budget_text}" _budget_text)
+    string(STRIP "${_template_budget_text}" _template_budget_text)
+    _budget_report("${BENCH_NAME} (${BENCH_COMPILER_ID})")
+    set(_budgets "budget: ${_budget_text}, each template: ${_template_budget_text}")
+    _budget_report("  compile  ${_total_text}  ${_budgets}")
+    if(_budget_us GREATER 0 AND _total_us GREATER _budget_us)
+        string(STRIP "${_total_text}" _value)
+        list(APPEND _failures "${BENCH_NAME}: compile ${_value} > ${_budget_text}")
+    endif()
+
+    # entries in order of the time, descending
+    set(_sorted)
+    foreach(_key IN LISTS _entries)
+        set(_us "000000000000${_entry_us_${_key}}")
+        string(LENGTH "${_us}" _length)
+        math(EXPR _start "${_length} - 12")
+        string(SUBSTRING "${_us}" ${_start} 12 _us)
+        list(APPEND _sorted "${_us}:${_key}")
+    endforeach()
+    list(SORT _sorted ORDER DESCENDING)
+
+    set(_shown 0)
+    foreach(_item IN LISTS _sorted)
+        string(REGEX REPLACE "^[0-9]+:" "" _key "${_item}")
+        set(_label "${_entry_label_${_key}}")
+        _budget_format_ms(${_entry_us_${_key}} _text)
+        string(STRIP "${_text}" _value)
+        set(_over FALSE)
+        if(_entry_kind_${_key} STREQUAL "TEMPLATE" AND _template_budget_us GREATER 0
+                AND _entry_us_${_key} GREATER _template_budget_us)
+            set(_over TRUE)
+            list(APPEND _failures
+                "${BENCH_NAME}: ${_label} ${_value} > ${_template_budget_text}")
+        endif()
+        if(_shown LESS REPORT_LIMIT OR _over)
+            if(_entry_kind_${_key} STREQUAL "TEMPLATE")
+                set(_kind "template")
+            else()
+                set(_kind "        ")
+            endif()
+            _budget_report(
+                "  ${_kind} ${_text}  ${_entry_count_${_key}}x  ${_label}")
+            math(EXPR _shown "${_shown} + 1")
+        endif()
+    endforeach()
+endforeach()
+
+if(_failures)
+    _budget_report("compile budgets exceeded:")
+    foreach(_failure IN LISTS _failures)
+        _budget_report("  ${_failure}")
+    endforeach()
+endif()
+
+file(WRITE ${OUTPUT_DIR}/compile_budgets.txt "${_report}")
+
+if(_failures)
+    message(FATAL_ERROR "Compile budgets exceeded, in ${OUTPUT_DIR}/compile_budgets.txt")
+endif()
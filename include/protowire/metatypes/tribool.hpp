@@ -0,0 +1,246 @@
+/**
+ * @file tribool.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief constexpr three-valued boolean type, without Boost
+ * @version 0.1
+ * @date 2026-01-24
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace protowire {
+namespace metatypes {
+
+class tribool;
+
+namespace detail {
+
+/// @brief unique parameter type for `indeterminate()`
+struct indeterminate_t {};
+
+}  // namespace detail
+
+/// @brief a tribool type with the interface of `boost::logic::tribool`,
+/// other than `tribool`
+///
+/// This is used for conversions to and from `boost::logic::tribool`,
+/// without including Boost headers.
+template <typename T>
+concept tribool_like = !std::is_same_v<std::remove_cvref_t<T>, tribool>
+                       && requires(T& v) {
+                            T(false);
+                            v.value = T::false_value;
+                            v.value = T::true_value;
+                            v.value = T::indeterminate_value;
+                          };
+
+/// @brief return true if `v` is indeterminate
+///
+/// As with `boost::logic::indeterminate`, this function can also be used
+/// as a keyword, to construct an indeterminate value: `tribool{indeterminate}`
+constexpr bool indeterminate(tribool v, detail::indeterminate_t = {}) noexcept;
+
+using indeterminate_keyword_t = bool (*)(tribool, detail::indeterminate_t) noexcept;
+
+/// @brief one-byte, three-valued boolean type, for constant expressions
+///
+/// Values are ordered as false < indeterminate < true. With this order,
+/// Kleene AND and OR are the minimum and maximum of two values, and NOT
+/// is the reflection of a value. Each operator is computed without
+/// branching.
+///
+/// `tribool` is a structural type, for use as a template parameter.
+/// Values convert implicitly to and from `boost::logic::tribool`.
+///
+/// Unlike `boost::logic::tribool`, `operator==` compares values by
+/// identity, returning `bool`. Two indeterminate values are equal.
+///
+/// Example:
+///
+/// ```cpp
+/// template <tribool V>
+/// struct checked { ... };
+///
+/// static_assert((tribool{true} && tribool{indeterminate}) == tribool{indeterminate});
+/// ```
+class tribool {
+public:
+  enum value_t : std::uint8_t {
+    false_value = 0,
+    indeterminate_value = 1,
+    true_value = 2,
+  };
+
+  /// @brief the value. This is public, for `tribool` as a structural type
+  value_t value;
+
+  /// @brief construct a false value
+  constexpr tribool() noexcept
+      : value{false_value} {}
+
+  constexpr tribool(bool v) noexcept
+      : value{static_cast<value_t>(static_cast<std::uint8_t>(v) << 1)} {}
+
+  constexpr tribool(indeterminate_keyword_t) noexcept
+      : value{indeterminate_value} {}
+
+  /// @brief construct from `boost::logic::tribool`, or a similar type
+  template <tribool_like T>
+  constexpr tribool(T const& v) noexcept
+      : value{(v.value == T::true_value)    ? true_value
+              : (v.value == T::false_value) ? false_value
+                                            : indeterminate_value} {}
+
+  /// @brief convert to `boost::logic::tribool`, or a similar type
+  template <tribool_like T>
+  constexpr operator T() const noexcept {
+    T result(false);
+    result.value = (value == true_value)    ? T::true_value
+                   : (value == false_value) ? T::false_value
+                                            : T::indeterminate_value;
+    return result;
+  }
+
+  /// @brief return true if the value is true
+  constexpr explicit operator bool() const noexcept { return value == true_value; }
+
+  /// @brief Kleene NOT
+  friend constexpr tribool operator!(tribool v) noexcept {
+    return from_code(true_value - v.value);
+  }
+
+  /// @brief Kleene AND, as the minimum of `a` and `b`
+  friend constexpr tribool operator&&(tribool a, tribool b) noexcept {
+    return from_code(b.value ^ ((a.value ^ b.value) & -int{a.value < b.value}));
+  }
+
+  /// @brief Kleene OR, as the maximum of `a` and `b`
+  friend constexpr tribool operator||(tribool a, tribool b) noexcept {
+    return from_code(a.value ^ ((a.value ^ b.value) & -int{a.value < b.value}));
+  }
+
+  friend constexpr bool operator==(tribool, tribool) noexcept = default;
+
+  // mixed operators, preferred to the built-in operators for `bool` and to
+  // the operators for `boost::logic::tribool`
+
+  friend constexpr tribool operator&&(tribool a, bool b) noexcept {
+    return a && tribool{b};
+  }
+
+  friend constexpr tribool operator&&(bool a, tribool b) noexcept {
+    return tribool{a} && b;
+  }
+
+  friend constexpr tribool operator||(tribool a, bool b) noexcept {
+    return a || tribool{b};
+  }
+
+  friend constexpr tribool operator||(bool a, tribool b) noexcept {
+    return tribool{a} || b;
+  }
+
+  template <tribool_like T>
+  friend constexpr tribool operator&&(tribool a, T const& b) noexcept {
+    return a && tribool{b};
+  }
+
+  template <tribool_like T>
+  friend constexpr tribool operator&&(T const& a, tribool b) noexcept {
+    return tribool{a} && b;
+  }
+
+  template <tribool_like T>
+  friend constexpr tribool operator||(tribool a, T const& b) noexcept {
+    return a || tribool{b};
+  }
+
+  template <tribool_like T>
+  friend constexpr tribool operator||(T const& a, tribool b) noexcept {
+    return tribool{a} || b;
+  }
+
+  template <tribool_like T>
+  friend constexpr bool operator==(tribool a, T const& b) noexcept {
+    return a == tribool{b};
+  }
+
+private:
+  static constexpr tribool from_code(int code) noexcept {
+    tribool result{};
+    result.value = static_cast<value_t>(code);
+    return result;
+  }
+};
+
+static_assert(sizeof(tribool) == 1);
+
+constexpr bool indeterminate(tribool v, detail::indeterminate_t) noexcept {
+  return v.value == tribool::indeterminate_value;
+}
+
+/// @brief integral constant type, for a value convertible to `tribool`
+template <typename T, T v>
+  requires (std::is_constructible_v<tribool, T>)
+struct tribool_constant {
+  using value_type = T;
+  using type = tribool_constant;
+  static constexpr T value = v;
+
+  constexpr operator value_type() const { return value; }
+
+  constexpr value_type operator()() const { return value; }
+
+  constexpr tribool_constant() noexcept = default;
+};
+
+struct indeterminate_type : tribool_constant<tribool, tribool{indeterminate}> {};
+
+struct true_type : tribool_constant<tribool, tribool{true}> {
+  constexpr operator bool() const { return true; }
+};
+
+struct false_type : tribool_constant<tribool, tribool{false}> {
+  constexpr operator bool() const { return false; }
+};
+
+template <tribool C, typename IndT, typename TrueT, typename FalseT>
+struct if_indeterminate_c {};
+
+template <typename IndT, typename TrueT, typename FalseT>
+struct if_indeterminate_c<tribool{indeterminate}, IndT, TrueT, FalseT> {
+  using type = IndT;
+};
+
+template <typename IndT, typename TrueT, typename FalseT>
+struct if_indeterminate_c<tribool{true}, IndT, TrueT, FalseT> {
+  using type = TrueT;
+};
+
+template <typename IndT, typename TrueT, typename FalseT>
+struct if_indeterminate_c<tribool{false}, IndT, TrueT, FalseT> {
+  using type = FalseT;
+};
+
+}  // namespace metatypes
+}  // namespace protowire
@@ -31,6 +31,8 @@
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/aux_/lambda_support.hpp>
 
+#include <protowire/metatypes/tribool.hpp>
+
 namespace protowire {
 namespace metatypes {
 
@@ -42,30 +44,6 @@ static constexpr logic::tribool indeterminate_value =
 static constexpr logic::tribool true_value = logic::tribool(true);
 static constexpr logic::tribool false_value = logic::tribool(false);
 
-template <typename T, T v>
-  requires (std::is_convertible_v<T, logic::tribool>)
-struct tribool_constant {
-  using value_type = T;
-  using type = tribool_constant;
-  static constexpr T value = v;
-
-  constexpr operator value_type() const { return value; }
-
-  constexpr value_type operator()() const { return value; }
-
-  constexpr tribool_constant() noexcept = default;
-};
-
-struct indeterminate_type : tribool_constant<logic::tribool, indeterminate_value> {};
-
-struct true_type : tribool_constant<logic::tribool, true_value> {
-  constexpr operator bool() const { return true; }
-};
-
-struct false_type : tribool_constant<logic::tribool, false_value> {
-  constexpr operator bool() const { return false; }
-};
-
 /// @brief unique tag type for a `tribool_` predicate type
 struct tribool_tag {};
 
@@ -95,40 +73,122 @@ struct false_ : tribool_<false_value> {
   constexpr operator bool() const { return false; }
 };
 
-template <logic::tribool C, typename IndT, typename TrueT, typename FalseT>
-struct if_indeterminate_c {};
-
-template <typename IndT, typename TrueT, typename FalseT>
-struct if_indeterminate_c<indeterminate_value, IndT, TrueT, FalseT> {
-  using type = IndT;
-};
-
-template <typename IndT, typename TrueT, typename FalseT>
-struct if_indeterminate_c<true_value, IndT, TrueT, FalseT> {
-  using type = TrueT;
-};
-
-template <typename IndT, typename TrueT, typename FalseT>
-struct if_indeterminate_c<false_value, IndT, TrueT, FalseT> {
-  using type = FalseT;
-};
-
 /// @brief  generally emulating boost::mpl::if_ for a tribool-valued type
 /// @tparam T predicate type, for member type selection.
-///         `T` must provide a static `value` member convertible to a
-///         Boost `tribool` object, whether generally indeterminate,
-///         or true or false.
+///         `T` must provide a static `value` member convertible to
+///         `tribool` or to a Boost `tribool` object, whether generally
+///         indeterminate, or true or false.
 /// @tparam IndT member type iff `T::value` is indeterminate
 /// @tparam TrueT member type iff `T::value` is true
 /// @tparam FalseT member type iff `T::value` is false
 template <typename T, typename IndT, typename TrueT, typename FalseT>
-  requires (std::is_convertible_v<decltype(T::value), logic::tribool>)
+  requires (std::is_constructible_v<tribool, decltype(T::value)>)
 struct if_indeterminate {
-  using _intermediate_c = if_indeterminate_c<T::value, IndT, TrueT, FalseT>;
+  using _intermediate_c = if_indeterminate_c<tribool{T::value}, IndT, TrueT, FalseT>;
   using type = _intermediate_c::type;
   BOOST_MPL_AUX_LAMBDA_SUPPORT(4, if_indeterminate, (T, IndT, TrueT, FalseT))
 };
 
+namespace detail {
+
+/// @brief Kleene order for tribool values, as false (0) < indeterminate (1) < true (2)
+constexpr int kleene_code(logic::tribool v) noexcept { return tribool{v}.value; }
+
+constexpr logic::tribool kleene_value(int code) noexcept {
+  return (code == 0) ? false_value : ((code == 2) ? true_value : indeterminate_value);
+}
+
+/// @brief Kleene AND, as the minimum of two values
+struct kleene_and_op {
+  static constexpr int identity = 2;
+  static constexpr int absorbing = 0;
+
+  static constexpr int code(logic::tribool v) noexcept { return kleene_code(v); }
+
+  static constexpr int combine(int a, int b) noexcept { return (a < b) ? a : b; }
+};
+
+/// @brief Kleene OR, as the maximum of two values
+struct kleene_or_op {
+  static constexpr int identity = 0;
+  static constexpr int absorbing = 2;
+
+  static constexpr int code(logic::tribool v) noexcept { return kleene_code(v); }
+
+  static constexpr int combine(int a, int b) noexcept { return (a > b) ? a : b; }
+};
+
+/// @brief true if each value is known, i.e AND of "not indeterminate"
+struct known_op : kleene_and_op {
+  static constexpr int code(logic::tribool v) noexcept {
+    return (kleene_code(v) == 1) ? 0 : 2;
+  }
+};
+
+template <typename Op, typename... Ps>
+constexpr int fold_codes() noexcept {
+  int r = Op::identity;
+  ((r = Op::combine(r, Op::code(Ps::value))), ...);
+  return r;
+}
+
+/// @brief fold of the predicates `Ps` for the operation `Op`
+///
+/// Predicates are folded in blocks of 16, with a fold expression for each
+/// block. Where the result is determined by a block, the remaining
+/// predicates are not instantiated. Otherwise, the result for the block is
+/// carried into the fold for the remaining predicates.
+template <typename Op, typename... Ps>
+struct kleene_fold {
+  using type = tribool_<kleene_value(fold_codes<Op, Ps...>())>;
+};
+
+template <typename Op, typename P0, typename P1, typename P2, typename P3, typename P4,
+          typename P5, typename P6, typename P7, typename P8, typename P9, typename P10,
+          typename P11, typename P12, typename P13, typename P14, typename P15,
+          typename... Rest>
+  requires (sizeof...(Rest) > 0)
+struct kleene_fold<Op, P0, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14,
+                   P15, Rest...> {
+  static constexpr int head = fold_codes<Op, P0, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10,
+                                         P11, P12, P13, P14, P15>();
+  using head_type = tribool_<kleene_value(head)>;
+
+  using type = typename std::conditional_t<head == Op::absorbing,
+                                           std::type_identity<head_type>,
+                                           kleene_fold<Op, head_type, Rest...>>::type;
+};
+
+}  // namespace detail
+
+/// @brief Kleene AND for tribool-valued predicate types
+///
+/// Each of `Ps` must provide a static `value` member convertible to a
+/// Boost `tribool` object. This type derives from `tribool_<v>` for the
+/// result `v`. For an empty `Ps`, the result is true.
+///
+/// Predicates following a false predicate may not be instantiated.
+template <typename... Ps>
+struct tribool_and : detail::kleene_fold<detail::kleene_and_op, Ps...>::type {};
+
+/// @brief Kleene OR for tribool-valued predicate types
+///
+/// As with `tribool_and`. For an empty `Ps`, the result is false.
+///
+/// Predicates following a true predicate may not be instantiated.
+template <typename... Ps>
+struct tribool_or : detail::kleene_fold<detail::kleene_or_op, Ps...>::type {};
+
+/// @brief Kleene NOT for a tribool-valued predicate type
+template <typename P>
+  requires (std::is_convertible_v<decltype(P::value), logic::tribool>)
+struct tribool_not : tribool_<detail::kleene_value(2 - detail::kleene_code(P::value))> {};
+
+/// @brief true if no predicate in `Ps` is indeterminate, else false
+///
+/// Predicates following an indeterminate predicate may not be instantiated.
+template <typename... Ps>
+struct tribool_all_known : detail::kleene_fold<detail::known_op, Ps...>::type {};
 
 }  // namespace metatypes
 }  // namespace protowire
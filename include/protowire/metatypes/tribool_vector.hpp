@@ -0,0 +1,307 @@
+/**
+ * @file tribool_vector.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief packed vector of tribool values, with three-valued logic kernels
+ * @version 0.1
+ * @date 2026-01-22
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool_p.hpp>
+#include <protowire/util/simd.hpp>
+
+namespace protowire {
+namespace metatypes {
+
+namespace detail {
+
+using tribool_word = std::uint64_t;
+
+// Kleene logic on bit-planes, for `n` words of each plane.
+//
+// Each value is encoded as a known bit `k` and a value bit `v`, with `v`
+// set only where `k` is set. For this encoding, `v` marks true values and
+// `k ^ v` marks false values.
+//
+//  AND: true  = va & vb,  false = (ka ^ va) | (kb ^ vb)
+//  OR:  true  = va | vb,  false = (ka ^ va) & (kb ^ vb)
+//  NOT: true  = ka ^ va,  known = ka
+
+inline void kleene_and(tribool_word* ka, tribool_word* va, tribool_word const* kb,
+                       tribool_word const* vb, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  for (; i + 4 <= n; i += 4) {
+    __m256i const a_k = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ka + i));
+    __m256i const a_v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(va + i));
+    __m256i const b_k = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(kb + i));
+    __m256i const b_v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(vb + i));
+    __m256i const t = _mm256_and_si256(a_v, b_v);
+    __m256i const f =
+          _mm256_or_si256(_mm256_xor_si256(a_k, a_v), _mm256_xor_si256(b_k, b_v));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ka + i), _mm256_or_si256(t, f));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(va + i), t);
+  }
+#endif
+  for (; i < n; ++i) {
+    tribool_word const t = va[i] & vb[i];
+    tribool_word const f = (ka[i] ^ va[i]) | (kb[i] ^ vb[i]);
+    ka[i] = t | f;
+    va[i] = t;
+  }
+}
+
+inline void kleene_or(tribool_word* ka, tribool_word* va, tribool_word const* kb,
+                      tribool_word const* vb, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  for (; i + 4 <= n; i += 4) {
+    __m256i const a_k = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ka + i));
+    __m256i const a_v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(va + i));
+    __m256i const b_k = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(kb + i));
+    __m256i const b_v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(vb + i));
+    __m256i const t = _mm256_or_si256(a_v, b_v);
+    __m256i const f =
+          _mm256_and_si256(_mm256_xor_si256(a_k, a_v), _mm256_xor_si256(b_k, b_v));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ka + i), _mm256_or_si256(t, f));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(va + i), t);
+  }
+#endif
+  for (; i < n; ++i) {
+    tribool_word const t = va[i] | vb[i];
+    tribool_word const f = (ka[i] ^ va[i]) & (kb[i] ^ vb[i]);
+    ka[i] = t | f;
+    va[i] = t;
+  }
+}
+
+inline void kleene_not(tribool_word const* ka, tribool_word* va, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  for (; i + 4 <= n; i += 4) {
+    __m256i const a_k = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ka + i));
+    __m256i const a_v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(va + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(va + i), _mm256_xor_si256(a_k, a_v));
+  }
+#endif
+  for (; i < n; ++i) {
+    va[i] ^= ka[i];
+  }
+}
+
+inline std::size_t popcount_words(tribool_word const* w, std::size_t n) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    count += static_cast<std::size_t>(std::popcount(w[i]));
+  }
+  return count;
+}
+
+}  // namespace detail
+
+/// @brief packed vector of tribool values
+///
+/// Values are stored as two bit-planes, for known values and for true
+/// values, using two bits per element. Kleene AND, OR and NOT apply to
+/// whole vectors, one word or one AVX2 register at a time.
+///
+/// Example:
+///
+/// ```cpp
+/// tribool_vector present(n, indeterminate_{});
+/// present.set(0, true_{});
+/// present &= required;
+/// std::size_t const unknown = present.count(indeterminate_value);
+/// ```
+class tribool_vector {
+public:
+  using word_type = detail::tribool_word;
+  static constexpr std::size_t word_bits = 64;
+
+  tribool_vector() noexcept = default;
+
+  /// @brief construct a vector of `n` values, each equal to `init`
+  explicit tribool_vector(std::size_t n, logic::tribool init = indeterminate_value)
+      : size_{n}, known_(word_count(n), 0), value_(word_count(n), 0) {
+    fill(init);
+  }
+
+  std::size_t size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// @brief resize the vector, with `init` for any new values
+  void resize(std::size_t n, logic::tribool init = indeterminate_value) {
+    std::size_t const old_size = size_;
+    known_.resize(word_count(n), 0);
+    value_.resize(word_count(n), 0);
+    size_ = n;
+    clear_tail();
+    for (std::size_t i = old_size; i < n; ++i) {
+      set(i, init);
+    }
+  }
+
+  logic::tribool operator[](std::size_t i) const noexcept {
+    word_type const bit = word_type{1} << (i % word_bits);
+    if ((known_[i / word_bits] & bit) == 0) {
+      return indeterminate_value;
+    }
+    return logic::tribool((value_[i / word_bits] & bit) != 0);
+  }
+
+  /// @brief return the value at `i`
+  /// @throws std::out_of_range if `i` is not less than `size()`
+  logic::tribool at(std::size_t i) const {
+    if (i >= size_) {
+      throw std::out_of_range("tribool_vector::at: index out of range");
+    }
+    return (*this)[i];
+  }
+
+  void set(std::size_t i, logic::tribool v) noexcept {
+    word_type const bit = word_type{1} << (i % word_bits);
+    word_type& k = known_[i / word_bits];
+    word_type& t = value_[i / word_bits];
+    if (logic::indeterminate(v)) {
+      k &= ~bit;
+      t &= ~bit;
+    } else {
+      k |= bit;
+      t = v ? (t | bit) : (t & ~bit);
+    }
+  }
+
+  /// @brief set the value at `i` from a `tribool_` constant, e.g `true_{}`
+  template <logic::tribool V>
+  void set(std::size_t i, tribool_<V>) noexcept {
+    set(i, V);
+  }
+
+  void fill(logic::tribool v) noexcept {
+    word_type const k = logic::indeterminate(v) ? 0 : ~word_type{0};
+    word_type const t = (!logic::indeterminate(v) && v) ? ~word_type{0} : 0;
+    std::fill(known_.begin(), known_.end(), k);
+    std::fill(value_.begin(), value_.end(), t);
+    clear_tail();
+  }
+
+  /// @brief return the number of values equal to `v`, where an
+  /// indeterminate `v` will count indeterminate values
+  std::size_t count(logic::tribool v) const noexcept {
+    std::size_t const n = known_.size();
+    if (logic::indeterminate(v)) {
+      return size_ - detail::popcount_words(known_.data(), n);
+    }
+    std::size_t const true_count = detail::popcount_words(value_.data(), n);
+    return v ? true_count : detail::popcount_words(known_.data(), n) - true_count;
+  }
+
+  template <logic::tribool V>
+  std::size_t count(tribool_<V>) const noexcept {
+    return count(V);
+  }
+
+  /// @brief Kleene AND, for values at each index
+  /// @throws std::length_error if the vectors differ in size
+  tribool_vector& operator&=(tribool_vector const& other) {
+    check_size(other);
+    detail::kleene_and(known_.data(), value_.data(), other.known_.data(),
+                       other.value_.data(), known_.size());
+    return *this;
+  }
+
+  /// @brief Kleene OR, for values at each index
+  /// @throws std::length_error if the vectors differ in size
+  tribool_vector& operator|=(tribool_vector const& other) {
+    check_size(other);
+    detail::kleene_or(known_.data(), value_.data(), other.known_.data(),
+                      other.value_.data(), known_.size());
+    return *this;
+  }
+
+  /// @brief Kleene NOT, for each value in place
+  tribool_vector& flip() noexcept {
+    detail::kleene_not(known_.data(), value_.data(), known_.size());
+    return *this;
+  }
+
+  // each operator returns the parameter `a` by name, such that it is moved
+  // and not copied
+
+  friend tribool_vector operator&(tribool_vector a, tribool_vector const& b) {
+    a &= b;
+    return a;
+  }
+
+  friend tribool_vector operator|(tribool_vector a, tribool_vector const& b) {
+    a |= b;
+    return a;
+  }
+
+  friend tribool_vector operator~(tribool_vector a) noexcept {
+    a.flip();
+    return a;
+  }
+
+  friend bool operator==(tribool_vector const&, tribool_vector const&) noexcept = default;
+
+  /// @brief bit-plane for known values. Bits past `size()` are zero
+  std::span<word_type const> known_words() const noexcept { return known_; }
+
+  /// @brief bit-plane for true values. Bits past `size()` are zero
+  std::span<word_type const> value_words() const noexcept { return value_; }
+
+private:
+  static constexpr std::size_t word_count(std::size_t n) noexcept {
+    return (n + word_bits - 1) / word_bits;
+  }
+
+  void clear_tail() noexcept {
+    if (std::size_t const rem = size_ % word_bits; rem != 0) {
+      word_type const mask = (word_type{1} << rem) - 1;
+      known_.back() &= mask;
+      value_.back() &= mask;
+    }
+  }
+
+  void check_size(tribool_vector const& other) const {
+    if (other.size_ != size_) {
+      throw std::length_error("tribool_vector: vectors differ in size");
+    }
+  }
+
+  std::size_t size_ = 0;
+  std::vector<word_type> known_{};
+  std::vector<word_type> value_{};
+};
+
+}  // namespace metatypes
+}  // namespace protowire
@@ -1,19 +1,165 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <boost/preprocessor/cat.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <protowire/test/object_repr.hpp>
+#include <protowire/util/simd.hpp>
+
+namespace protowire {
+namespace test {
+namespace check_str {
+
+/// @brief a type convertible to `std::string_view`, or a contiguous range
+/// of single-byte values, e.g `std::span<std::byte const>`
+template <typename T>
+concept byte_view_like =
+      std::is_convertible_v<T const&, std::string_view>
+      || (std::ranges::contiguous_range<T const> && std::ranges::sized_range<T const>
+          && sizeof(std::ranges::range_value_t<T const>) == 1
+          && std::is_trivially_copyable_v<std::ranges::range_value_t<T const>>);
+
+/// @brief return a view of the bytes of `ob`, without copying
+template <byte_view_like T>
+std::string_view as_string_view(T const& ob) noexcept {
+  if constexpr (std::is_convertible_v<T const&, std::string_view>) {
+    return ob;
+  } else {
+    return std::string_view{reinterpret_cast<char const*>(std::ranges::data(ob)),
+                            std::ranges::size(ob)};
+  }
+}
+
+/// @brief size of each haystack chunk for `find_each()`
+inline constexpr std::size_t find_chunk_size = 64 * 1024;
+
+/// @brief find the first occurrence of each needle within `haystack`,
+/// writing each offset to `positions`, or `util::simd::npos` if not found
+///
+/// The haystack is searched in chunks of `find_chunk_size` bytes, for
+/// each needle not yet found. Each chunk is read from memory once, for
+/// all needles.
+///
+/// @return the number of needles found
+inline std::size_t find_each(std::string_view haystack,
+                             std::span<std::string_view const> needles,
+                             std::span<std::size_t> positions) noexcept {
+  std::size_t const n = haystack.size();
+  std::size_t remaining = needles.size();
+  for (std::size_t j = 0; j < needles.size(); ++j) {
+    positions[j] = needles[j].empty() ? 0 : util::simd::npos;
+    remaining -= needles[j].empty() ? 1 : 0;
+  }
+  for (std::size_t c = 0; c < n && remaining != 0; c += find_chunk_size) {
+    for (std::size_t j = 0; j < needles.size(); ++j) {
+      std::string_view const needle = needles[j];
+      if (positions[j] != util::simd::npos) {
+        continue;
+      }
+      // offsets from `c`, to the end of the chunk
+      std::size_t const len = std::min(n - c, find_chunk_size + needle.size() - 1);
+      std::size_t const pos =
+            util::simd::find(haystack.data() + c, len, needle.data(), needle.size());
+      if (pos != util::simd::npos) {
+        positions[j] = c + pos;
+        --remaining;
+      }
+    }
+  }
+  return needles.size() - remaining;
+}
+
+/// @brief result of `str_find()`
+struct find_result {
+  /// @brief the first needle not found, if any
+  std::string_view missing{};
+  bool found = true;
+
+  explicit operator bool() const noexcept { return found; }
+};
+
+/// @brief a needle for `str_find()`: a `char`, or a value convertible to
+/// `std::string_view`
+template <typename T>
+concept str_needle =
+      std::same_as<T, char> || std::is_convertible_v<T const&, std::string_view>;
+
+namespace detail {
+
+/// @brief a view of the character `c`, which must outlive the view
+template <std::same_as<char> C>
+std::string_view needle_view(C const& c) noexcept {
+  return std::string_view{&c, 1};
+}
+
+inline std::string_view needle_view(std::string_view s) noexcept {
+  return s;
+}
+
+/// other arithmetic needles are not converted to `char`, e.g the start
+/// position in `CHECK_STR_FIND(str, needle, pos)`
+template <typename T>
+  requires (std::is_arithmetic_v<T> && !std::same_as<T, char>)
+std::string_view needle_view(T const&) = delete;
+
+}  // namespace detail
+
+/// @brief search for each needle within `haystack`, in one pass
+///
+/// Each needle is a `char`, or a value convertible to `std::string_view`
+template <typename... Needles>
+  requires (sizeof...(Needles) > 0 && (str_needle<Needles> && ...))
+find_result str_find(std::string_view haystack, Needles const&... needles) noexcept {
+  std::array<std::string_view, sizeof...(Needles)> const views{
+        detail::needle_view(needles)...};
+  std::array<std::size_t, sizeof...(Needles)> positions{};
+  if (find_each(haystack, views, positions) == views.size()) {
+    return find_result{};
+  }
+  for (std::size_t j = 0; j < views.size(); ++j) {
+    if (positions[j] == util::simd::npos) {
+      return find_result{views[j], false};
+    }
+  }
+  return find_result{};
+}
+
+}  // namespace check_str
+}  // namespace test
+}  // namespace protowire
+
+// CHECK_STR_FIND(str, needles...) checks that each needle occurs within
+// `str`, for a string, string view or contiguous byte range. The value of
+// `str` is not copied, and is represented only if the check fails
+//
+// Each needle is a `char` or a string. The previous form with a start
+// position, CHECK_STR_FIND(str, needle, pos), is not supported
 
 #ifndef CHECK_STR_FIND
 #define CHECK_STR_FIND(str, ...)                                                         \
   {                                                                                      \
-    UNSCOPED_INFO("CHECK_STR_FIND(" << #str << ", " << #__VA_ARGS__ << ")");             \
-    ::std::string const BOOST_PP_CAT(__test_str_, __LINE__) = str;                       \
-    UNSCOPED_INFO(#str << " => "                                                         \
-                       << ::protowire::test::object_repr::repr_string(                   \
-                                BOOST_PP_CAT(__test_str_, __LINE__)));                   \
-    CHECK(!!(BOOST_PP_CAT(__test_str_, __LINE__).find(__VA_ARGS__)                       \
-             != BOOST_PP_CAT(__test_str_, __LINE__).npos));                              \
+    auto const& BOOST_PP_CAT(__test_str_, __LINE__) = str;                               \
+    auto const BOOST_PP_CAT(__test_find_, __LINE__) =                                    \
+          ::protowire::test::check_str::str_find(                                        \
+                ::protowire::test::check_str::as_string_view(                            \
+                      BOOST_PP_CAT(__test_str_, __LINE__)),                              \
+                __VA_ARGS__);                                                            \
+    if (!BOOST_PP_CAT(__test_find_, __LINE__)) {                                         \
+      UNSCOPED_INFO("CHECK_STR_FIND(" << #str << ", " << #__VA_ARGS__ << ")");           \
+      UNSCOPED_INFO(#str << " => "                                                       \
+                         << ::protowire::test::object_repr::repr_string(                 \
+                                  BOOST_PP_CAT(__test_str_, __LINE__)));                 \
+      UNSCOPED_INFO("not found: " << ::protowire::test::object_repr::repr_string(        \
+                          BOOST_PP_CAT(__test_find_, __LINE__).missing));                \
+    }                                                                                    \
+    CHECK(!!BOOST_PP_CAT(__test_find_, __LINE__));                                       \
   }
 #endif
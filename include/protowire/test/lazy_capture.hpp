@@ -0,0 +1,267 @@
+/**
+ * @file lazy_capture.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief Catch2 messages rendered only for failed assertions
+ * @version 0.1
+ * @date 2026-01-29
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_assertion_info.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_version_macros.hpp>
+#include <catch2/interfaces/catch_interfaces_reporter.hpp>
+#include <catch2/internal/catch_message_info.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/type_repr.hpp>
+
+/// @brief true if lazy messages are added to each failed assertion by the
+/// `lazy_message_listener`, for assertions other than the `typecatch` checks
+///
+/// The listener adds to the messages of the `AssertionStats` for the
+/// assertion. This is not a documented interface of Catch2, and depends on
+/// Catch2 notifying each listener before any reporter, with the same
+/// statistics object, as for Catch2 3.0.1 through 3.x. For other versions,
+/// lazy messages are reported only in the failure branch of each typecatch
+/// check, or with `LAZY_UNSCOPED_INFO()`
+#ifndef PROTOWIRE_LAZY_LISTENER_MESSAGES
+#if CATCH_VERSION_MAJOR == 3 && (CATCH_VERSION_MINOR > 0 || CATCH_VERSION_PATCH >= 1)
+#define PROTOWIRE_LAZY_LISTENER_MESSAGES 1
+#else
+#define PROTOWIRE_LAZY_LISTENER_MESSAGES 0
+#endif
+#endif
+
+namespace protowire {
+namespace test {
+namespace typecatch {
+
+/// @brief a message for Catch2, rendered only if reported
+///
+/// The message is rendered as `<expr> := <repr>`, with the representation
+/// from `render(ob, out)`
+struct lazy_message {
+  Catch::StringRef macro_name;
+  Catch::SourceLineInfo line_info;
+  char const* expr;
+  void const* ob;
+  void (*render)(void const* ob, std::string& out);
+
+  std::string str() const {
+    std::string s{expr};
+    s.append(" := ");
+    render(ob, s);
+    return s;
+  }
+};
+
+namespace detail {
+
+/// @brief render `*ob` as with `repr_string()`, for `T` as deduced for a
+/// forwarding reference
+template <typename T>
+void render_repr(void const* ob, std::string& out) {
+  using value_type = std::remove_reference_t<T>;
+  value_type& ref = *static_cast<value_type*>(const_cast<void*>(ob));
+  object_repr::repr_string_to(static_cast<T&&>(ref), std::back_inserter(out));
+}
+
+template <typename T>
+void render_type(void const*, std::string& out) {
+  out.append(type_repr::type_repr<T>::apply());
+}
+
+/// @brief lazy messages for the current thread
+struct lazy_state {
+  /// @brief scoped messages, in order of declaration
+  std::vector<lazy_message const*> scoped{};
+  /// @brief unscoped messages, in order of declaration
+  std::vector<lazy_message> unscoped{};
+  /// @brief number of unscoped messages for the current assertion
+  std::size_t attached = 0;
+  /// @brief true if messages for the next assertion were rendered with
+  /// `render_lazy_messages()`
+  bool rendered = false;
+};
+
+inline lazy_state& thread_lazy_state() {
+  thread_local lazy_state state{};
+  return state;
+}
+
+/// @brief event listener, releasing unscoped lazy messages after each
+/// assertion
+///
+/// With `PROTOWIRE_LAZY_LISTENER_MESSAGES`, lazy messages are also added
+/// after any other messages for each failed assertion, unless rendered
+/// for the assertion with `render_lazy_messages()`
+class lazy_message_listener : public Catch::EventListenerBase {
+public:
+  using Catch::EventListenerBase::EventListenerBase;
+
+  void assertionStarting(Catch::AssertionInfo const&) override {
+    // unscoped messages apply to the first assertion after each message
+    lazy_state& state = thread_lazy_state();
+    state.unscoped.erase(state.unscoped.begin(),
+                         state.unscoped.begin()
+                               + static_cast<std::ptrdiff_t>(state.attached));
+    state.attached = state.unscoped.size();
+  }
+
+  void assertionEnded([[maybe_unused]] Catch::AssertionStats const& stats) override {
+    lazy_state& state = thread_lazy_state();
+    if (std::exchange(state.rendered, false)) {
+      return;
+    }
+#if PROTOWIRE_LAZY_LISTENER_MESSAGES
+    // as with other messages, including for a failure with `CHECK_NOFAIL`
+    if (stats.assertionResult.succeeded()) {
+      return;
+    }
+    auto& messages = const_cast<std::vector<Catch::MessageInfo>&>(stats.infoMessages);
+    for (lazy_message const* const msg : state.scoped) {
+      add(messages, *msg);
+    }
+    for (std::size_t i = 0; i < state.attached; ++i) {
+      add(messages, state.unscoped[i]);
+    }
+#endif
+  }
+
+  void testCaseEnded(Catch::TestCaseStats const&) override {
+    lazy_state& state = thread_lazy_state();
+    state.unscoped.clear();
+    state.attached = 0;
+    state.rendered = false;
+  }
+
+private:
+  static void add(std::vector<Catch::MessageInfo>& messages, lazy_message const& msg) {
+    Catch::MessageInfo info{msg.macro_name, msg.line_info, Catch::ResultWas::Info};
+    info.message = msg.str();
+    messages.push_back(std::move(info));
+  }
+};
+
+inline Catch::ListenerRegistrar<lazy_message_listener> const lazy_message_registrar{
+      "protowire_lazy_message"};
+
+}  // namespace detail
+
+/// @brief render each lazy message for the next assertion, i.e each scoped
+/// message and each unscoped message recorded since the last assertion
+///
+/// The messages are not added to the next assertion by the listener. This
+/// is used in the failure branch of each typecatch check, reporting the
+/// messages with `UNSCOPED_INFO`, as in `LAZY_UNSCOPED_INFO()`
+inline std::vector<std::string> render_lazy_messages() {
+  detail::lazy_state& state = detail::thread_lazy_state();
+  std::vector<std::string> messages{};
+  messages.reserve(state.scoped.size() + state.unscoped.size() - state.attached);
+  for (lazy_message const* const msg : state.scoped) {
+    messages.push_back(msg->str());
+  }
+  for (std::size_t i = state.attached; i < state.unscoped.size(); ++i) {
+    messages.push_back(state.unscoped[i].str());
+  }
+  state.rendered = true;
+  return messages;
+}
+
+/// @brief scoped lazy message, generally emulating `INFO` for a value or
+/// a type. For a temporary value, the value is stored in the scope.
+template <typename T>
+class lazy_capture {
+public:
+  lazy_capture(Catch::StringRef macro_name, Catch::SourceLineInfo const& line_info,
+               char const* expr, T&& ob)
+      : ob_{std::forward<T>(ob)},
+        msg_{macro_name, line_info, expr, std::addressof(ob_), &detail::render_repr<T>} {
+    detail::thread_lazy_state().scoped.push_back(&msg_);
+  }
+
+  ~lazy_capture() { detail::thread_lazy_state().scoped.pop_back(); }
+
+  lazy_capture(lazy_capture const&) = delete;
+  lazy_capture& operator=(lazy_capture const&) = delete;
+
+private:
+  T ob_;
+  lazy_message const msg_;
+};
+
+template <typename T>
+lazy_capture(Catch::StringRef, Catch::SourceLineInfo const&, char const*, T&&)
+      -> lazy_capture<T>;
+
+/// @brief scoped lazy message for the type `T`
+template <typename T>
+class lazy_capture_type {
+public:
+  lazy_capture_type(Catch::StringRef macro_name, Catch::SourceLineInfo const& line_info,
+                    char const* expr)
+      : msg_{macro_name, line_info, expr, nullptr, &detail::render_type<T>} {
+    detail::thread_lazy_state().scoped.push_back(&msg_);
+  }
+
+  ~lazy_capture_type() { detail::thread_lazy_state().scoped.pop_back(); }
+
+  lazy_capture_type(lazy_capture_type const&) = delete;
+  lazy_capture_type& operator=(lazy_capture_type const&) = delete;
+
+private:
+  lazy_message const msg_;
+};
+
+/// @brief unscoped lazy message for the value `ob`, generally emulating
+/// `UNSCOPED_INFO`
+///
+/// The message is rendered only if the next assertion fails. `ob` should
+/// not be destroyed before the next assertion.
+template <typename T>
+  requires (std::is_lvalue_reference_v<T>)
+void lazy_record(Catch::StringRef macro_name, Catch::SourceLineInfo const& line_info,
+                 char const* expr, T&& ob) {
+  detail::thread_lazy_state().unscoped.push_back(
+        lazy_message{macro_name, line_info, expr, std::addressof(ob),
+                     &detail::render_repr<T>});
+}
+
+/// @brief unscoped lazy message for the type `T`
+template <typename T>
+void lazy_record_type(Catch::StringRef macro_name, Catch::SourceLineInfo const& line_info,
+                      char const* expr) {
+  detail::thread_lazy_state().unscoped.push_back(
+        lazy_message{macro_name, line_info, expr, nullptr, &detail::render_type<T>});
+}
+
+}  // namespace typecatch
+}  // namespace test
+}  // namespace protowire
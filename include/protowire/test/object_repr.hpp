@@ -24,18 +24,29 @@
 
 #pragma once
 
+#include <algorithm>
+#include <charconv>
 #include <concepts>
-#include <iomanip>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <ostream>
+#include <ranges>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <type_traits>
-
-#include <boost/nowide/stackstring.hpp>
+#include <variant>
 
 #include <protowire/test/type_repr.hpp>
+#include <protowire/util/base64.hpp>
 #include <protowire/util/lstring.hpp>
+#include <protowire/util/simd.hpp>
+#include <protowire/util/utf.hpp>
 
 namespace protowire {
 namespace test {
@@ -45,61 +56,484 @@ using protowire::util::lstring::LString;
 using protowire::test::type_repr::type_repr;
 using protowire::test::type_repr::with_repr_stream;
 
-template <typename T, LString Name>
-struct const_name_repr {
-  // note usage for nullopt_t, nullptr_t
+/// @brief quoting for the representation of text
+enum class quote_mode {
+  /// @brief printable ASCII and valid UTF-8, with C-style escapes for any
+  /// other bytes, e.g `"A\tB\x00"`
+  escape,
+  /// @brief a `\xNN` escape for each byte, e.g for binary data
+  hex,
+};
 
-  static std::string apply(T const&) { return Name.template pack<std::string>(); }
+/// @brief format for the representation of byte buffers
+enum class byte_format {
+  /// @brief two hex digits for each byte, e.g `hex"00ff"`
+  hex,
+  /// @brief lines of offset, hex and ASCII text, as with `hexdump -C`
+  hexdump,
+  /// @brief base64 encoding, e.g `base64"AP8="`
+  base64,
+};
 
-  template <typename CharT, typename Traits>
-  static void apply(T const&, std::basic_ostream<CharT, Traits>& b) {
-    using str_type = std::basic_string<CharT, Traits>;
-    b << Name.template pack<str_type>();
+namespace detail {
+
+inline constexpr char hex_digits[] = "0123456789abcdef";
+
+/// @brief write `s` to `out`. Where `out` provides `append(s)`, e.g for
+/// `repr_arena`, the string is appended in one call
+template <typename OutIt>
+OutIt put(std::string_view const& s, OutIt out) {
+  if constexpr (requires { out.append(s); }) {
+    out.append(s);
+    return out;
+  } else {
+    return std::copy(s.begin(), s.end(), out);
+  }
+}
+
+template <typename OutIt>
+OutIt put(char c, OutIt out) {
+  *out = c;
+  return ++out;
+}
+
+/// @brief write the byte `c` as a C-style escape sequence to `buf`, e.g
+/// `\n`, `\"` or `\x7f`
+///
+/// @return the number of characters written, at most 4
+inline std::size_t escape_to(unsigned char c, char* buf) noexcept {
+  char esc = 0;
+  switch (c) {
+    case '\a': esc = 'a'; break;
+    case '\b': esc = 'b'; break;
+    case '\f': esc = 'f'; break;
+    case '\n': esc = 'n'; break;
+    case '\r': esc = 'r'; break;
+    case '\t': esc = 't'; break;
+    case '\v': esc = 'v'; break;
+    case '"':
+    case '\'':
+    case '\\': esc = static_cast<char>(c); break;
+    default: break;
+  }
+  buf[0] = '\\';
+  if (esc != 0) {
+    buf[1] = esc;
+    return 2;
+  }
+  buf[1] = 'x';
+  buf[2] = hex_digits[c >> 4];
+  buf[3] = hex_digits[c & 0xF];
+  return 4;
+}
+
+/// @brief write `s` for text quoted with `Delim`, with a C-style escape
+/// for the delimiter, backslash, each control character and each byte not
+/// within a valid UTF-8 sequence
+///
+/// Runs of printable ASCII are found with `util::simd::plain_prefix()`, and
+/// written in one call. Escape sequences are collected in a local buffer
+template <char Delim, typename OutIt>
+OutIt put_escaped(std::string_view const& s, OutIt out) {
+  char buf[256];
+  std::size_t len = 0;
+  char const* p = s.data();
+  char const* const e = p + s.size();
+  while (p != e) {
+    std::size_t const k =
+          util::simd::plain_prefix(p, static_cast<std::size_t>(e - p), Delim);
+    if (k != 0) {
+      if (len != 0) {
+        out = put(std::string_view{buf, len}, out);
+        len = 0;
+      }
+      out = put(std::string_view{p, k}, out);
+      p += k;
+      if (p == e) {
+        break;
+      }
+    }
+    if (len > sizeof(buf) - 4) {
+      out = put(std::string_view{buf, len}, out);
+      len = 0;
+    }
+    if (static_cast<unsigned char>(*p) >= 0x80) {
+      char const* next = p;
+      if (util::utf::decode(next, e) != util::utf::invalid_code_point) {
+        // a valid sequence, of at most 4 bytes
+        for (; p != next; ++p) {
+          buf[len++] = *p;
+        }
+        continue;
+      }
+    }
+    len += escape_to(static_cast<unsigned char>(*p++), buf + len);
+  }
+  if (len != 0) {
+    out = put(std::string_view{buf, len}, out);
+  }
+  return out;
+}
+
+/// @brief write `s` with a `\xNN` escape for each byte
+template <typename OutIt>
+OutIt put_hex_escaped(std::string_view const& s, OutIt out) {
+  char buf[256];
+  std::size_t len = 0;
+  for (char const c : s) {
+    auto const b = static_cast<unsigned char>(c);
+    buf[len] = '\\';
+    buf[len + 1] = 'x';
+    buf[len + 2] = hex_digits[b >> 4];
+    buf[len + 3] = hex_digits[b & 0xF];
+    len += 4;
+    if (len == sizeof(buf)) {
+      out = put(std::string_view{buf, len}, out);
+      len = 0;
+    }
+  }
+  return put(std::string_view{buf, len}, out);
+}
+
+/// @brief write `s` for text quoted with `Delim`, as with `mode`
+template <char Delim, typename OutIt>
+OutIt put_text(std::string_view const& s, quote_mode mode, OutIt out) {
+  if (mode == quote_mode::hex) {
+    return put_hex_escaped(s, out);
+  }
+  return put_escaped<Delim>(s, out);
+}
+
+/// @brief write `s` as a quoted string, as with `put_text()`
+template <typename OutIt>
+OutIt put_quoted(std::string_view const& s, quote_mode mode, OutIt out) {
+  out = put('"', out);
+  out = put_text<'"'>(s, mode, out);
+  return put('"', out);
+}
+
+/// @brief write `s` as UTF-8, for text quoted with `Delim`, as with
+/// `put_text()`
+///
+/// Invalid sequences in `s` will be written as the replacement character
+template <char Delim, typename CharT, typename OutIt>
+OutIt put_utf8(std::basic_string_view<CharT> const& s, quote_mode mode, OutIt out) {
+  util::utf::to_utf8(s.data(), s.size(), [&out, mode](std::string_view const& segment) {
+    out = put_text<Delim>(segment, mode, out);
+  });
+  return out;
+}
+
+/// @brief output iterator appending to a string, with `append(s)` for
+/// each string written with `put()`
+class string_appender {
+public:
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
+
+  explicit string_appender(std::string* str) noexcept
+      : str_{str} {}
+
+  string_appender& operator=(char c) {
+    str_->push_back(c);
+    return *this;
   }
+
+  void append(std::string_view s) { str_->append(s); }
+
+  string_appender& operator*() noexcept { return *this; }
+
+  string_appender& operator++() noexcept { return *this; }
+
+  string_appender operator++(int) noexcept { return *this; }
+
+private:
+  std::string* str_;
 };
 
-template <typename T>
-struct object_repr {
+/// @brief scratch buffers for the current thread
+struct scratch_state {
+  /// @brief one buffer for each level of nested `repr_scratch`. Elements
+  /// of a deque are not moved when appending
+  std::deque<std::string> buffers{};
+  std::size_t used = 0;
+};
+
+inline scratch_state& thread_scratch_state() noexcept {
+  thread_local scratch_state state{};
+  return state;
+}
+
+}  // namespace detail
+
+/// @brief largest capacity retained for a scratch buffer, after release
+inline constexpr std::size_t scratch_retain_size = 64 * 1024;
+
+/// @brief a per-thread scratch buffer, for a representation
+///
+/// The buffer is cleared when acquired and returned to the current thread
+/// on destruction, retaining its storage up to `scratch_retain_size`.
+/// After warmup, a representation written to a scratch buffer will not
+/// allocate, and threads do not contend in the allocator. A nested scratch
+/// buffer uses a separate buffer, e.g for an `object_repr` implementation
+/// calling `repr_string()`.
+class repr_scratch {
+public:
+  repr_scratch()
+      : state_{detail::thread_scratch_state()} {
+    if (state_.used == state_.buffers.size()) {
+      state_.buffers.emplace_back();
+    }
+    buf_ = &state_.buffers[state_.used++];
+    buf_->clear();
+  }
+
+  ~repr_scratch() {
+    if (buf_->capacity() > scratch_retain_size) {
+      std::string{}.swap(*buf_);
+    }
+    --state_.used;
+  }
+
+  repr_scratch(repr_scratch const&) = delete;
+  repr_scratch& operator=(repr_scratch const&) = delete;
+
+  std::string& buffer() noexcept { return *buf_; }
+
+  std::string_view view() const noexcept { return *buf_; }
+
+  /// @brief return an output iterator appending to the buffer
+  detail::string_appender appender() noexcept { return detail::string_appender{buf_}; }
+
+private:
+  detail::scratch_state& state_;
+  std::string* buf_;
+};
+
+/// @brief default `apply()` interfaces for an `object_repr` implementation
+/// providing a static `format_to(ob, out)` function
+///
+/// Each representation is written to a `repr_scratch` buffer, such that a
+/// string is allocated once at its final size, and a stream receives one
+/// write
+///
+/// @tparam Impl implementation type
+/// @tparam T value type
+template <typename Impl, typename T>
+struct repr_interface {
   static std::string apply(T const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
+    repr_scratch scratch{};
+    Impl::format_to(ob, scratch.appender());
+    return std::string{scratch.view()};
   }
 
   template <typename CharT, typename Traits>
   static void apply(T const& ob, std::basic_ostream<CharT, Traits>& b) {
-    b << type_repr<T>::apply();
-    b << "{{???}}}";
+    if constexpr (std::is_same_v<CharT, char>) {
+      repr_scratch scratch{};
+      Impl::format_to(ob, scratch.appender());
+      b.write(scratch.view().data(), static_cast<std::streamsize>(scratch.view().size()));
+    } else {
+      Impl::format_to(ob, std::ostreambuf_iterator<CharT, Traits>(b));
+    }
   }
 };
 
 template <typename T>
-  requires (std::is_const_v<T>)
-struct object_repr<T> {
-  using value_type = T;
+struct object_repr;
 
-  static std::string apply(value_type& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
+/// @brief true if `object_repr<T>` provides a `format_to(ob, out)` function
+template <typename T>
+concept formattable_repr =
+      requires(T const& ob, std::back_insert_iterator<std::string> out) {
+        { object_repr<T>::format_to(ob, out) } -> std::same_as<decltype(out)>;
+      };
+
+/// @brief write the representation of `ob` to the output iterator `out`
+///
+/// For `object_repr` specializations not providing `format_to()`,
+/// this will copy the string produced with `apply()`
+///
+/// @return iterator past the last character written
+template <typename T, typename OutIt>
+OutIt repr_format_to(T const& ob, OutIt out) {
+  if constexpr (formattable_repr<T>) {
+    return object_repr<T>::format_to(ob, out);
+  } else {
+    return detail::put(object_repr<T>::apply(ob), out);
   }
+}
 
-  template <typename CharT, typename Traits>
-  static void apply(value_type& ob, std::basic_ostream<CharT, Traits>& b) {
-    b << object_repr<std::remove_cv_t<T>>::apply(ob);
-    b << " /** " << type_repr<T>::apply() << " **/";
+/// @brief limits for the representation of containers, tuples and variants,
+/// and the quoting for text
+struct repr_limits {
+  /// @brief maximum number of elements to write for each container. Any
+  /// further elements are summarized, e.g `... 99,990 more`
+  std::size_t max_elements = 100;
+
+  /// @brief maximum nesting depth for containers, tuples and variants.
+  /// Below this depth, only the type of each object is written
+  std::size_t max_depth = 16;
+
+  /// @brief quoting for strings and characters
+  quote_mode quoting = quote_mode::escape;
+
+  /// @brief format for byte buffers
+  byte_format bytes = byte_format::hex;
+
+  /// @brief maximum number of bytes to write for each byte buffer. For a
+  /// larger buffer, only the first and last `max_bytes / 2` bytes are
+  /// written, with the number of bytes omitted
+  std::size_t max_bytes = 1024;
+};
+
+namespace detail {
+
+struct repr_state {
+  repr_limits limits{};
+  std::size_t depth = 0;
+};
+
+inline repr_state& thread_repr_state() noexcept {
+  thread_local repr_state state{};
+  return state;
+}
+
+/// @brief scope for one level of nesting. If the maximum depth has been
+/// reached, `entered()` will return false
+class depth_guard {
+public:
+  depth_guard() noexcept
+      : state_{thread_repr_state()}, entered_{state_.depth < state_.limits.max_depth} {
+    if (entered_) {
+      ++state_.depth;
+    }
+  }
+
+  ~depth_guard() {
+    if (entered_) {
+      --state_.depth;
+    }
+  }
+
+  depth_guard(depth_guard const&) = delete;
+  depth_guard& operator=(depth_guard const&) = delete;
+
+  bool entered() const noexcept { return entered_; }
+
+private:
+  repr_state& state_;
+  bool const entered_;
+};
+
+/// @brief write `n` in decimal, with `,` between each group of three digits
+template <typename OutIt>
+OutIt put_grouped(std::size_t n, OutIt out) {
+  char buf[std::numeric_limits<std::size_t>::digits10 + 1];
+  std::to_chars_result const res = std::to_chars(std::begin(buf), std::end(buf), n);
+  std::size_t const len = static_cast<std::size_t>(res.ptr - buf);
+  for (std::size_t i = 0; i < len; ++i) {
+    if (i != 0 && (len - i) % 3 == 0) {
+      out = put(',', out);
+    }
+    out = put(buf[i], out);
+  }
+  return out;
+}
+
+}  // namespace detail
+
+/// @brief return the `repr_limits` for the current thread
+inline repr_limits const& current_repr_limits() noexcept {
+  return detail::thread_repr_state().limits;
+}
+
+/// @brief set the `repr_limits` for the current thread, restoring the
+/// previous limits on destruction
+///
+/// Example:
+///
+/// ```cpp
+/// scoped_repr_limits const limits{{.max_elements = 10, .max_depth = 4}};
+/// std::string const s = repr_string(message.fields);
+/// ```
+class scoped_repr_limits {
+public:
+  explicit scoped_repr_limits(repr_limits const& limits) noexcept
+      : saved_{std::exchange(detail::thread_repr_state().limits, limits)} {}
+
+  ~scoped_repr_limits() { detail::thread_repr_state().limits = saved_; }
+
+  scoped_repr_limits(scoped_repr_limits const&) = delete;
+  scoped_repr_limits& operator=(scoped_repr_limits const&) = delete;
+
+private:
+  repr_limits saved_;
+};
+
+template <typename T, LString Name>
+struct const_name_repr : repr_interface<const_name_repr<T, Name>, T> {
+  // note usage for nullopt_t, nullptr_t
+
+  template <typename OutIt>
+  static OutIt format_to(T const&, OutIt out) {
+    return detail::put(Name.template pack<std::string_view>(), out);
   }
 };
 
 template <typename T>
-  requires (std::is_convertible_v<
-            std::void_t<decltype(std::to_string(std::declval<T const&>()))>, void
-  >)
-struct object_repr<T> {
-  static std::string apply(T const& ob) { return std::to_string(ob); }
+struct object_repr : repr_interface<object_repr<T>, T> {
+  template <typename OutIt>
+  static OutIt format_to(T const&, OutIt out) {
+    out = detail::put(type_repr<T>::apply(), out);
+    return detail::put("{{???}}}", out);
+  }
+};
 
-  template <typename CharT, typename Traits>
-  static void apply(T const& ob, std::basic_ostream<CharT, Traits>& b) {
-    b << type_repr<T>::apply();
-    b << "{{";
-    b << std::to_string(ob);
-    b << "}}";
+template <typename T>
+struct object_repr<T&> : object_repr<T> {};
+
+template <typename T>
+struct object_repr<T&&> : object_repr<T> {};
+
+template <typename T>
+  requires (std::is_const_v<T>)
+struct object_repr<T> : repr_interface<object_repr<T>, T> {
+  using value_type = T;
+
+  template <typename OutIt>
+  static OutIt format_to(value_type& ob, OutIt out) {
+    out = repr_format_to<std::remove_cv_t<T>>(ob, out);
+    out = detail::put(" /** ", out);
+    out = detail::put(type_repr<T>::apply(), out);
+    return detail::put(" **/", out);
+  }
+};
+
+template <typename T>
+  requires (!std::is_const_v<T>
+            && std::is_convertible_v<
+                  std::void_t<decltype(std::to_string(std::declval<T const&>()))>, void
+            >)
+struct object_repr<T> : repr_interface<object_repr<T>, T> {
+  template <typename OutIt>
+  static OutIt format_to(T const& ob, OutIt out) {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+      char buf[std::numeric_limits<T>::digits10 + 3];
+      std::to_chars_result const res = std::to_chars(std::begin(buf), std::end(buf), ob);
+      return std::copy(std::begin(buf), res.ptr, out);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      // consistent with std::to_string(ob), i.e "%f"
+      char buf[std::numeric_limits<T>::max_exponent10 + 32];
+      std::to_chars_result const res = std::to_chars(
+            std::begin(buf), std::end(buf), ob, std::chars_format::fixed, 6);
+      return std::copy(std::begin(buf), res.ptr, out);
+    } else {
+      return detail::put(std::to_string(ob), out);
+    }
   }
 };
 
@@ -129,6 +563,43 @@ std::string repr_string(T const* const ob) {
   return object_repr<T const*>::apply(ob);
 }
 
+/// @brief write the representation of `ob` to the output iterator `out`,
+/// with the same representation as `repr_string(ob)`
+///
+/// @return iterator past the last character written
+template <typename T, typename OutIt>
+OutIt repr_string_to(T&& ob, OutIt out) {
+  return repr_format_to<T>(ob, out);
+}
+
+template <typename T, typename OutIt>
+OutIt repr_string_to(T const&& ob, OutIt out) {
+  return repr_format_to<T const>(ob, out);
+}
+
+template <typename T, typename OutIt>
+OutIt repr_string_to(T* const ob, OutIt out) {
+  return repr_format_to<T*>(ob, out);
+}
+
+template <typename T, typename OutIt>
+OutIt repr_string_to(T const* const ob, OutIt out) {
+  return repr_format_to<T const*>(ob, out);
+}
+
+/// @brief call `func` with a string view for the representation of `ob`
+///
+/// The representation is written to a `repr_scratch` buffer, valid until
+/// `func` returns
+///
+/// @return the value returned by `func`
+template <typename T, typename F>
+decltype(auto) with_repr_view(T const& ob, F&& func) {
+  repr_scratch scratch{};
+  repr_format_to(ob, scratch.appender());
+  return std::forward<F>(func)(scratch.view());
+}
+
 template <typename T, typename CharT, typename Traits>
 void repr_write(T const& ob, std::basic_ostream<CharT, Traits>& stream) {
   object_repr<T>::apply(ob, stream);
@@ -139,55 +610,74 @@ struct string_prefix : type_repr<C> {};
 
 template <typename C>
 struct string_prefix<char, C> {
-  static std::string const apply() { return ""; }
+  static constexpr LString value{""};
+
+  static constexpr std::string_view apply() { return value.view(); }
 };
 
 template <typename C>
 struct string_prefix<wchar_t, C> {
-  static std::string const apply() { return "L"; }
+  static constexpr LString value{"L"};
+
+  static constexpr std::string_view apply() { return value.view(); }
 };
 
 template <typename C>
 struct string_prefix<char8_t, C> {
-  static std::string const apply() { return "u8"; }
+  static constexpr LString value{"u8"};
+
+  static constexpr std::string_view apply() { return value.view(); }
 };
 
 template <typename C>
 struct string_prefix<char16_t, C> {
-  static std::string const apply() { return "u"; }
+  static constexpr LString value{"u"};
+
+  static constexpr std::string_view apply() { return value.view(); }
 };
 
 template <typename C>
 struct string_prefix<char32_t, C> {
-  static std::string const apply() { return "U"; }
+  static constexpr LString value{"U"};
+
+  static constexpr std::string_view apply() { return value.view(); }
 };
 
+/// @brief write a quoted representation of the text `s`, with a string
+/// literal prefix for the character type `CharT`.
+///
+/// Text in non-`char` types will be transcoded to UTF-8. The text is
+/// escaped as with `current_repr_limits().quoting`
+template <typename CharT, typename C, typename OutIt>
+OutIt text_format_to(std::basic_string_view<CharT> const& s, OutIt out) {
+  quote_mode const mode = current_repr_limits().quoting;
+  if constexpr (std::is_same_v<CharT, char>) {
+    return detail::put_quoted(s, mode, out);
+  } else {
+    out = detail::put(string_prefix<CharT, C>::apply(), out);
+    out = detail::put('"', out);
+    out = detail::put_utf8<'"'>(s, mode, out);
+    return detail::put('"', out);
+  }
+}
+
 template <typename CharT, typename C>
-struct text_repr {
+struct text_repr : repr_interface<text_repr<CharT, C>, C> {
   using value_type = C;
 
-  static std::string apply(value_type const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
-  }
-
   static CharT const* data(value_type const& obj)
     requires (std::is_convertible_v<decltype(std::declval<value_type const&>().data()),
                                     CharT const*>) {
     return obj.data();
   }
 
-  static void apply(value_type const& ob, std::ostream& b) {
-
-    b << type_repr<C>::apply();
-    b << "{{";
-    if constexpr (std::is_same_v<CharT, char>) {
-      b << std::quoted(ob);
-    } else {
-      b << string_prefix<CharT, value_type>::apply();
-      // this assumes UTF-8 encoding for result strings
-      b << std::quoted(boost::nowide::basic_stackstring<char, CharT>(data(ob)).get());
-    }
-    b << "}}";
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<C>::apply(), out);
+    out = detail::put("{{", out);
+    out = text_format_to<CharT, value_type>(
+          std::basic_string_view<CharT>{ob.data(), ob.size()}, out);
+    return detail::put("}}", out);
   }
 };
 
@@ -200,35 +690,32 @@ struct object_repr<std::basic_string_view<CharT, Traits>>
     : text_repr<CharT, std::basic_string_view<CharT, Traits>> {};
 
 template <>
-struct object_repr<char> {
+struct object_repr<char> : repr_interface<object_repr<char>, char> {
   using value_type = char;
 
-  static std::string apply(value_type const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
-  }
-
-  static void apply(value_type const& ob, std::ostream& b) {
-    b << '\'';
-    b << ob;
-    b << '\'';
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put('\'', out);
+    out = detail::put_text<'\''>(std::string_view{&ob, 1}, current_repr_limits().quoting,
+                                 out);
+    return detail::put('\'', out);
   }
 };
 
 template <typename CharT>
-struct char_repr {
+struct char_repr : repr_interface<char_repr<CharT>, CharT> {
   using value_type = CharT;
 
-  static std::string apply(value_type const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
-  }
+  /// @brief character literal prefix and opening quote, e.g `u8'`
+  static constexpr LString open_quote =
+        string_prefix<value_type, value_type>::value + "'";
 
-  static void apply(value_type const& ob, std::ostream& b) {
-    std::basic_string<CharT> s;
-    s = ob;
-    b << string_prefix<value_type, value_type>::apply();
-    b << '\'';
-    b << boost::nowide::basic_stackstring<char, CharT>(s.c_str()).get();
-    b << '\'';
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(open_quote.view(), out);
+    out = detail::put_utf8<'\''>(std::basic_string_view<CharT>{&ob, 1},
+                                 current_repr_limits().quoting, out);
+    return detail::put('\'', out);
   }
 };
 
@@ -245,20 +732,15 @@ template <>
 struct object_repr<char32_t> : char_repr<char32_t> {};
 
 template <typename CharT, typename C>
-struct char_ptr_repr {
+struct char_ptr_repr : repr_interface<char_ptr_repr<CharT, C>, C> {
   using value_type = C;
 
-  static std::string apply(value_type const ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
-  }
-
-  static void apply(value_type const ob, std::ostream& b) {
-    if constexpr (std::is_same_v<CharT, char>) {
-      b << std::quoted(ob);
-    } else {
-      b << string_prefix<CharT, value_type>::apply();
-      b << std::quoted(boost::nowide::basic_stackstring<char, CharT>(ob).get());
+  template <typename OutIt>
+  static OutIt format_to(value_type const ob, OutIt out) {
+    if (ob == nullptr) {
+      return detail::put("nullptr", out);
     }
+    return text_format_to<CharT, value_type>(std::basic_string_view<CharT>{ob}, out);
   }
 };
 
@@ -278,21 +760,15 @@ template <>
 struct object_repr<char32_t const*> : char_ptr_repr<char32_t, char32_t const*> {};
 
 template <typename CharT, typename C>
-struct char_nc_ptr_repr {
+struct char_nc_ptr_repr : repr_interface<char_nc_ptr_repr<CharT, C>, C> {
   using value_type = C;
 
-  static std::string apply(C const ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
-  }
-
-  static void apply(C const ob, std::ostream& b) {
-    if constexpr (std::is_same_v<CharT, char>) {
-      b << std::quoted(ob);
-    } else {
-      b << string_prefix<CharT, C>::apply();
-      b << std::quoted(boost::nowide::basic_stackstring<char, CharT>(ob).get());
-    }
-    b << " /** " << type_repr<C>::apply() << " **/";
+  template <typename OutIt>
+  static OutIt format_to(C const ob, OutIt out) {
+    out = char_ptr_repr<CharT, CharT const*>::format_to(ob, out);
+    out = detail::put(" /** ", out);
+    out = detail::put(type_repr<C>::apply(), out);
+    return detail::put(" **/", out);
   }
 };
 
@@ -320,48 +796,408 @@ template <>
 struct object_repr<std::nullptr_t> : const_name_repr<std::nullptr_t, "nullptr"> {};
 
 template <typename T>
-struct object_repr<std::optional<T>> {
+struct object_repr<std::optional<T>> : repr_interface<object_repr<std::optional<T>>,
+                                                      std::optional<T>> {
   using value_type = std::optional<T>;
 
-  static std::string apply(value_type const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<value_type>::apply(), out);
+    if (ob.has_value()) {
+      out = detail::put("{{", out);
+      out = repr_format_to<T>(ob.value(), out);
+      return detail::put("}}", out);
+    } else {
+      return detail::put("{std::nullopt}", out);
+    }
   }
+};
 
-  static void apply(value_type const& ob, std::ostream& b) {
-    b << type_repr<value_type>::apply();
-    if (ob.has_value()) {
-      b << "{{";
-      object_repr<T>::apply(ob.value(), b);
-      b << "}}";
+template <typename T>
+  requires (!std::is_const_v<T> && !std::ranges::range<T>
+            && std::is_convertible_v<std::remove_pointer_t<typename T::pointer>,
+                                     typename T::element_type>)
+struct object_repr<T> : repr_interface<object_repr<T>, T> {
+  using value_type = T;
+
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<value_type>::apply(), out);
+    if (ob) {
+      out = detail::put("{{", out);
+      out = repr_format_to<typename T::element_type>(*ob, out);
+      return detail::put("}}", out);
     } else {
-      b << "{std::nullopt}";
+      return detail::put("{nullptr}", out);
     }
   }
 };
 
+// --
+
+namespace detail {
+
 template <typename T>
-  requires (std::is_convertible_v<std::remove_pointer_t<typename T::pointer>,
-                                  typename T::element_type>)
-struct object_repr<T> {
+struct is_text : std::false_type {};
+
+template <typename CharT, typename Traits, typename Alloc>
+struct is_text<std::basic_string<CharT, Traits, Alloc>> : std::true_type {};
+
+template <typename CharT, typename Traits>
+struct is_text<std::basic_string_view<CharT, Traits>> : std::true_type {};
+
+/// @brief write the elements of a tuple-like object `ob`, separated by `, `
+template <typename T, typename OutIt>
+OutIt put_elements(T const& ob, OutIt out) {
+  return std::apply(
+        [&out](auto const&... elts) {
+          bool first = true;
+          ((out = put(std::exchange(first, false) ? "" : ", ", out),
+            out = repr_format_to<std::remove_cvref_t<decltype(elts)>>(elts, out)),
+           ...);
+          return out;
+        },
+        ob);
+}
+
+}  // namespace detail
+
+/// @brief a range type, for `range_repr`
+///
+/// Strings and string views are represented as text, not as ranges
+template <typename T>
+concept repr_range =
+      std::ranges::input_range<T const> && !std::is_const_v<T>
+      && !detail::is_text<T>::value;
+
+/// @brief a range of key and mapped values, e.g `std::map`
+template <typename T>
+concept repr_map = repr_range<T> && requires {
+  typename T::key_type;
+  typename T::mapped_type;
+};
+
+/// @brief representation for ranges, e.g `std::vector<int>{{1, 2, 3}}`
+///
+/// Elements are written directly to the output. Following the first
+/// `current_repr_limits().max_elements` elements, the number of remaining
+/// elements is written, if known, as e.g `... 99,990 more`
+template <typename T>
+struct range_repr : repr_interface<range_repr<T>, T> {
   using value_type = T;
 
-  static std::string apply(value_type const& ob) {
-    return with_repr_stream([&ob](std::stringstream& b) { apply(ob, b); });
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<T>::apply(), out);
+    detail::depth_guard const guard{};
+    if (!guard.entered()) {
+      return detail::put("{...}", out);
+    }
+    out = detail::put("{{", out);
+    std::size_t const limit = current_repr_limits().max_elements;
+    std::size_t n = 0;
+    auto it = std::ranges::begin(ob);
+    auto const end = std::ranges::end(ob);
+    for (; it != end && n < limit; ++it, ++n) {
+      if (n != 0) {
+        out = detail::put(", ", out);
+      }
+      out = element_format_to(*it, out);
+    }
+    if (it != end) {
+      out = detail::put((n == 0) ? "..." : ", ...", out);
+      if constexpr (std::ranges::sized_range<T const>) {
+        std::size_t const size = static_cast<std::size_t>(std::ranges::size(ob));
+        out = detail::put(' ', out);
+        out = detail::put_grouped(size - n, out);
+        out = detail::put(" more", out);
+      } else if constexpr (std::ranges::forward_range<T const>) {
+        std::size_t const rest = static_cast<std::size_t>(std::ranges::distance(it, end));
+        out = detail::put(' ', out);
+        out = detail::put_grouped(rest, out);
+        out = detail::put(" more", out);
+      }
+    }
+    return detail::put("}}", out);
+  }
+
+private:
+  using element_type = std::ranges::range_value_t<T const>;
+
+  template <typename OutIt>
+  static OutIt element_format_to(element_type const& elt, OutIt out) {
+    if constexpr (repr_map<T>) {
+      out = detail::put('{', out);
+      out = detail::put_elements(elt, out);
+      return detail::put('}', out);
+    } else {
+      return repr_format_to<element_type>(elt, out);
+    }
   }
+};
 
-  void apply(value_type const& ob, std::ostream& b) {
-    b << type_repr<value_type>::apply();
-    if (ob) {
-      b << "{{";
-      object_repr<typename T::element_type>::apply(*ob, b);
-      b << "}}";
+/// @brief a contiguous range of bytes, e.g `std::span<std::byte const>` or
+/// `std::vector<std::uint8_t>`, for `bytes_repr`
+template <typename T>
+concept repr_bytes =
+      repr_range<T> && std::ranges::contiguous_range<T const>
+      && std::ranges::sized_range<T const>
+      && (std::is_same_v<std::ranges::range_value_t<T const>, std::byte>
+          || std::is_same_v<std::ranges::range_value_t<T const>, unsigned char>);
+
+template <typename T>
+  requires (repr_range<T> && !repr_bytes<T>)
+struct object_repr<T> : range_repr<T> {};
+
+namespace detail {
+
+/// @brief write the `n` bytes at `p` as a quoted string, e.g `hex"00ff"`
+/// or `base64"AP8="`, for `byte_format::hex` or `byte_format::base64`
+template <typename OutIt>
+OutIt put_encoded_bytes(unsigned char const* p, std::size_t n, byte_format format,
+                        OutIt out) {
+  char buf[512];
+  if (format == byte_format::base64) {
+    out = put("base64\"", out);
+    // a multiple of 3 bytes for each chunk, without padding
+    for (std::size_t i = 0; i < n; i += 384) {
+      std::size_t const k = std::min<std::size_t>(384, n - i);
+      out = put(std::string_view{buf, util::base64::encode(p + i, k, buf)}, out);
+    }
+  } else {
+    out = put("hex\"", out);
+    for (std::size_t i = 0; i < n; i += 256) {
+      std::size_t const k = std::min<std::size_t>(256, n - i);
+      util::simd::hex_encode(p + i, k, buf);
+      out = put(std::string_view{buf, k * 2}, out);
+    }
+  }
+  return put('"', out);
+}
+
+/// @brief write lines as with `hexdump -C`, for the bytes at offsets
+/// `[start, end)` of `p`, with `start` a multiple of 16
+template <typename OutIt>
+OutIt put_hexdump(unsigned char const* p, std::size_t start, std::size_t end, OutIt out) {
+  // e.g `00000010  61 62 63 64 65 66 67 68  69 6a 6b 6c 6d 6e 6f 70  |abcdefghijklmnop|`
+  char line[80];
+  for (std::size_t offset = start; offset < end; offset += 16) {
+    std::size_t const k = std::min<std::size_t>(16, end - offset);
+    char digits[32];
+    util::simd::hex_encode(p + offset, k, digits);
+    for (std::size_t i = 0; i < 8; ++i) {
+      line[i] = hex_digits[(offset >> ((7 - i) * 4)) & 0xF];
+    }
+    std::size_t len = 8;
+    for (std::size_t i = 0; i < 16; ++i) {
+      if (i == 0 || i == 8) {
+        line[len++] = ' ';
+      }
+      line[len++] = ' ';
+      line[len++] = (i < k) ? digits[i * 2] : ' ';
+      line[len++] = (i < k) ? digits[i * 2 + 1] : ' ';
+    }
+    line[len++] = ' ';
+    line[len++] = ' ';
+    line[len++] = '|';
+    for (std::size_t i = 0; i < k; ++i) {
+      unsigned char const c = p[offset + i];
+      line[len++] = (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '.';
+    }
+    line[len++] = '|';
+    line[len++] = '\n';
+    out = put(std::string_view{line, len}, out);
+  }
+  return out;
+}
+
+}  // namespace detail
+
+/// @brief representation for byte buffers, e.g
+/// `std::vector<std::byte>{{hex"0001ff"}}`
+///
+/// The format is selected with `current_repr_limits().bytes`. For a buffer
+/// larger than `current_repr_limits().max_bytes`, only the first and last
+/// bytes are written, e.g `{{hex"0001" ... 99,996 bytes ... hex"feff"}}`.
+/// An empty head or tail is not written, e.g `{{... 10 bytes ...}}` for a
+/// `max_bytes` of 0
+template <typename T>
+struct bytes_repr : repr_interface<bytes_repr<T>, T> {
+  using value_type = T;
+
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    auto const* const p = reinterpret_cast<unsigned char const*>(std::ranges::data(ob));
+    auto const n = static_cast<std::size_t>(std::ranges::size(ob));
+    repr_limits const& limits = current_repr_limits();
+    out = detail::put(type_repr<T>::apply(), out);
+    out = detail::put("{{", out);
+
+    std::size_t head = n;
+    std::size_t tail = n;
+    if (n > limits.max_bytes) {
+      head = limits.max_bytes / 2;
+      tail = n - (limits.max_bytes - head);
+      if (limits.bytes == byte_format::hexdump) {
+        // whole lines, at the offsets of the complete buffer. The last
+        // line may be partial, such that `tail` is at most `n`
+        head -= head % 16;
+        tail = std::min(n, tail + (16 - tail % 16) % 16);
+      }
+    }
+
+    if (limits.bytes == byte_format::hexdump) {
+      if (n != 0) {
+        out = detail::put('\n', out);
+      }
+      out = detail::put_hexdump(p, 0, head, out);
+      if (head < n) {
+        out = omitted_format_to(tail - head, out);
+        out = detail::put('\n', out);
+        out = detail::put_hexdump(p, tail, n, out);
+      }
     } else {
-      b << "{nullptr}";
+      if (head != 0 || n == 0) {
+        out = detail::put_encoded_bytes(p, head, limits.bytes, out);
+      }
+      if (head < n) {
+        if (head != 0) {
+          out = detail::put(' ', out);
+        }
+        out = omitted_format_to(tail - head, out);
+        if (tail != n) {
+          out = detail::put(' ', out);
+          out = detail::put_encoded_bytes(p + tail, n - tail, limits.bytes, out);
+        }
+      }
     }
+    return detail::put("}}", out);
+  }
+
+private:
+  template <typename OutIt>
+  static OutIt omitted_format_to(std::size_t n, OutIt out) {
+    out = detail::put("... ", out);
+    out = detail::put_grouped(n, out);
+    return detail::put(" bytes ...", out);
   }
 };
 
+template <typename T>
+  requires (repr_bytes<T>)
+struct object_repr<T> : bytes_repr<T> {};
+
+/// @brief representation for `std::pair` and `std::tuple`, e.g
+/// `std::pair<int, char>{{1, 'x'}}`
+template <typename T>
+struct tuple_repr : repr_interface<tuple_repr<T>, T> {
+  using value_type = T;
+
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<T>::apply(), out);
+    detail::depth_guard const guard{};
+    if (!guard.entered()) {
+      return detail::put("{...}", out);
+    }
+    out = detail::put("{{", out);
+    out = detail::put_elements(ob, out);
+    return detail::put("}}", out);
+  }
+};
+
+template <typename First, typename Second>
+struct object_repr<std::pair<First, Second>> : tuple_repr<std::pair<First, Second>> {};
+
+template <typename... Ts>
+struct object_repr<std::tuple<Ts...>> : tuple_repr<std::tuple<Ts...>> {};
+
+template <>
+struct object_repr<std::monostate>
+    : const_name_repr<std::monostate, "std::monostate{}"> {};
+
+/// @brief representation for `std::variant`, with the active alternative
+/// e.g `std::variant<int, char>{{'x'}}`
+template <typename... Ts>
+struct object_repr<std::variant<Ts...>>
+    : repr_interface<object_repr<std::variant<Ts...>>, std::variant<Ts...>> {
+  using value_type = std::variant<Ts...>;
+
+  template <typename OutIt>
+  static OutIt format_to(value_type const& ob, OutIt out) {
+    out = detail::put(type_repr<value_type>::apply(), out);
+    if (ob.valueless_by_exception()) {
+      return detail::put("{std::variant_npos}", out);
+    }
+    detail::depth_guard const guard{};
+    if (!guard.entered()) {
+      return detail::put("{...}", out);
+    }
+    out = detail::put("{{", out);
+    out = std::visit(
+          [&out](auto const& alt) {
+            return repr_format_to<std::remove_cvref_t<decltype(alt)>>(alt, out);
+          },
+          ob);
+    return detail::put("}}", out);
+  }
+};
+
+}  // namespace object_repr
+}  // namespace test
+}  // namespace protowire
+
+// specializations compiled in the protowire_util library, as
+// `X(T, Impl)` for `object_repr<T>` implemented with `Impl`
+
+#define PROTOWIRE_OBJECT_REPR_LIBRARY_TYPES(X)                                           \
+  X(std::string, text_repr<char, std::string>)                                           \
+  X(std::wstring, text_repr<wchar_t, std::wstring>)                                      \
+  X(std::u8string, text_repr<char8_t, std::u8string>)                                    \
+  X(std::u16string, text_repr<char16_t, std::u16string>)                                 \
+  X(std::u32string, text_repr<char32_t, std::u32string>)                                 \
+  X(std::string_view, text_repr<char, std::string_view>)                                 \
+  X(std::wstring_view, text_repr<wchar_t, std::wstring_view>)                            \
+  X(std::u8string_view, text_repr<char8_t, std::u8string_view>)                          \
+  X(std::u16string_view, text_repr<char16_t, std::u16string_view>)                       \
+  X(std::u32string_view, text_repr<char32_t, std::u32string_view>)                       \
+  X(char, object_repr<char>)                                                             \
+  X(wchar_t, char_repr<wchar_t>)                                                         \
+  X(char8_t, char_repr<char8_t>)                                                         \
+  X(char16_t, char_repr<char16_t>)                                                       \
+  X(char32_t, char_repr<char32_t>)                                                       \
+  X(std::optional<int>, object_repr<std::optional<int>>)                                 \
+  X(std::optional<long>, object_repr<std::optional<long>>)                               \
+  X(std::optional<unsigned>, object_repr<std::optional<unsigned>>)                       \
+  X(std::optional<double>, object_repr<std::optional<double>>)                           \
+  X(std::optional<std::string>, object_repr<std::optional<std::string>>)
+
+// explicit instantiation of `apply(ob)`, and `format_to(ob, out)` for
+// the output iterators used in `repr_string()` and `repr_string_to()`,
+// with `EXTERN` either `extern` or empty
+
+#define PROTOWIRE_OBJECT_REPR_INSTANTIATE(EXTERN, T, ...)                                \
+  EXTERN template struct repr_interface<__VA_ARGS__, T>;                                 \
+  EXTERN template detail::string_appender __VA_ARGS__::format_to(                        \
+        T const&, detail::string_appender);                                              \
+  EXTERN template std::back_insert_iterator<std::string> __VA_ARGS__::format_to(         \
+        T const&, std::back_insert_iterator<std::string>);
+
+#if defined(PROTOWIRE_UTIL_LIBRARY)
+
+#define PROTOWIRE_OBJECT_REPR_EXTERN(T, ...)                                             \
+  PROTOWIRE_OBJECT_REPR_INSTANTIATE(extern, T, __VA_ARGS__)
+
+namespace protowire {
+namespace test {
+namespace object_repr {
+
+PROTOWIRE_OBJECT_REPR_LIBRARY_TYPES(PROTOWIRE_OBJECT_REPR_EXTERN)
 
 }  // namespace object_repr
 }  // namespace test
 }  // namespace protowire
+
+#undef PROTOWIRE_OBJECT_REPR_EXTERN
+
+#endif
@@ -0,0 +1,284 @@
+/**
+ * @file repr_arena.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief object representations without heap allocation, after warmup
+ * @version 0.1
+ * @date 2026-01-27
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <protowire/test/object_repr.hpp>
+
+namespace protowire {
+namespace test {
+namespace object_repr {
+
+namespace detail {
+
+/// @brief output iterator calling `sink->push(c)` for each character,
+/// or `sink->append(s)` for a string
+template <typename Sink>
+class push_iterator {
+public:
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
+
+  explicit push_iterator(Sink* sink) noexcept
+      : sink_{sink} {}
+
+  push_iterator& operator=(char c) {
+    sink_->push(c);
+    return *this;
+  }
+
+  void append(std::string_view s) { sink_->append(s); }
+
+  push_iterator& operator*() noexcept { return *this; }
+
+  push_iterator& operator++() noexcept { return *this; }
+
+  push_iterator operator++(int) noexcept { return *this; }
+
+private:
+  Sink* sink_;
+};
+
+}  // namespace detail
+
+/// @brief representation stored inline, for up to `N` characters
+///
+/// A longer representation is stored in a `std::string`. The inline
+/// buffer is not used after the first `N` characters.
+///
+/// Example:
+///
+/// ```cpp
+/// std::cerr << repr_inline(message.header) << '\n';
+/// ```
+template <std::size_t N = 120>
+class inline_repr {
+public:
+  static constexpr std::size_t inline_size = N;
+
+  inline_repr() noexcept = default;
+
+  std::string_view view() const noexcept {
+    return (size_ <= N) ? std::string_view{buf_, size_} : std::string_view{spill_};
+  }
+
+  operator std::string_view() const noexcept { return view(); }
+
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief return true if the representation is stored inline
+  bool is_inline() const noexcept { return size_ <= N; }
+
+  template <typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(
+        std::basic_ostream<CharT, Traits>& stream, inline_repr const& r) {
+    return stream << r.view();
+  }
+
+  /// @brief return an output iterator appending to the representation
+  detail::push_iterator<inline_repr> appender() noexcept {
+    return detail::push_iterator<inline_repr>{this};
+  }
+
+  void push(char c) {
+    if (size_ < N) {
+      buf_[size_++] = c;
+      return;
+    }
+    if (size_ == N) {
+      spill_.reserve(N * 2);
+      spill_.assign(buf_, N);
+    }
+    spill_.push_back(c);
+    ++size_;
+  }
+
+  void append(std::string_view s) {
+    if (size_ + s.size() <= N) {
+      std::memcpy(buf_ + size_, s.data(), s.size());
+      size_ += s.size();
+      return;
+    }
+    for (char const c : s) {
+      push(c);
+    }
+  }
+
+private:
+  std::size_t size_ = 0;
+  char buf_[N];
+  std::string spill_{};
+};
+
+/// @brief return the representation of `ob`, as with `repr_string(ob)`,
+/// stored inline for up to `N` characters
+template <std::size_t N = 120, typename T>
+inline_repr<N> repr_inline(T&& ob) {
+  inline_repr<N> result{};
+  repr_string_to(std::forward<T>(ob), result.appender());
+  return result;
+}
+
+/// @brief bump allocator for object representations
+///
+/// Each representation is stored contiguously in an arena block, and
+/// remains valid until `reset()`. After `reset()`, the arena retains its
+/// storage, such that a cycle of representations no larger than previous
+/// cycles will not allocate.
+///
+/// Example:
+///
+/// ```cpp
+/// repr_arena arena{};
+/// for (auto const& msg : messages) {
+///   log(arena.repr(msg.id), arena.repr(msg.fields));
+///   arena.reset();
+/// }
+/// ```
+class repr_arena {
+public:
+  static constexpr std::size_t default_block_size = 4096;
+
+  explicit repr_arena(std::size_t block_size = default_block_size)
+      : block_size_{std::max<std::size_t>(block_size, 64)} {}
+
+  repr_arena(repr_arena const&) = delete;
+  repr_arena& operator=(repr_arena const&) = delete;
+
+  /// @brief return the representation of `ob`, as with `repr_string(ob)`
+  ///
+  /// The string view is valid until `reset()`, or the destruction of
+  /// the arena
+  template <typename T>
+  std::string_view repr(T&& ob) {
+    start_ = pos_;
+    repr_string_to(std::forward<T>(ob), detail::push_iterator<repr_arena>{this});
+    if (pos_ == start_) {
+      return std::string_view{};
+    }
+    return std::string_view{data_ + start_, pos_ - start_};
+  }
+
+  /// @brief release all representations, retaining storage
+  ///
+  /// Where more than one block was used, blocks are replaced with a
+  /// single block of the total size
+  void reset() {
+    if (blocks_.size() > 1) {
+      std::size_t total = 0;
+      for (block const& b : blocks_) {
+        total += b.size;
+      }
+      blocks_.clear();
+      add_block(total);
+    }
+    pos_ = 0;
+    start_ = 0;
+  }
+
+  /// @brief total bytes in use, for representations since `reset()`
+  std::size_t used() const noexcept {
+    std::size_t total = pos_;
+    for (std::size_t i = 0; i + 1 < blocks_.size(); ++i) {
+      total += blocks_[i].used;
+    }
+    return total;
+  }
+
+  /// @brief total bytes reserved for blocks
+  std::size_t capacity() const noexcept {
+    std::size_t total = 0;
+    for (block const& b : blocks_) {
+      total += b.size;
+    }
+    return total;
+  }
+
+  void push(char c) {
+    if (pos_ == limit_) {
+      overflow(1);
+    }
+    data_[pos_++] = c;
+  }
+
+  void append(std::string_view s) {
+    if (limit_ - pos_ < s.size()) {
+      overflow(s.size());
+    }
+    std::memcpy(data_ + pos_, s.data(), s.size());
+    pos_ += s.size();
+  }
+
+private:
+  struct block {
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  void add_block(std::size_t size) {
+    blocks_.push_back(block{std::make_unique_for_overwrite<char[]>(size), size, 0});
+    data_ = blocks_.back().data.get();
+    limit_ = size;
+  }
+
+  /// @brief continue the current representation in a new block, with
+  /// space for at least `n` more characters
+  void overflow(std::size_t n) {
+    std::size_t const len = pos_ - start_;
+    add_block(std::max(block_size_, (len + n) * 2));
+    if (blocks_.size() > 1) {
+      block& prev = blocks_[blocks_.size() - 2];
+      prev.used = start_;
+      std::memcpy(data_, prev.data.get() + start_, len);
+    }
+    start_ = 0;
+    pos_ = len;
+  }
+
+  std::size_t block_size_;
+  std::vector<block> blocks_{};
+  char* data_ = nullptr;
+  std::size_t limit_ = 0;
+  std::size_t start_ = 0;
+  std::size_t pos_ = 0;
+};
+
+}  // namespace object_repr
+}  // namespace test
+}  // namespace protowire
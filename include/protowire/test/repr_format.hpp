@@ -0,0 +1,144 @@
+/**
+ * @file repr_format.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief std::format integration for object and type representations
+ * @version 0.1
+ * @date 2026-01-12
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+#if defined(PROTOWIRE_REPR_FMT)
+#include <fmt/format.h>
+#endif
+
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/type_repr.hpp>
+
+namespace protowire {
+namespace test {
+namespace repr_format {
+
+/// @brief format argument wrapper for `object_repr<T>`
+///
+/// Example:
+///
+/// ```cpp
+/// std::format("value: {:>40}", repr{ob});
+/// ```
+///
+/// The representation is formatted as a string, supporting the
+/// standard format specification for strings.
+///
+/// The wrapper holds a reference to `ob` and should not outlive it.
+template <typename T>
+struct repr {
+  T const& ob;
+
+  constexpr explicit repr(T const& ob) noexcept
+      : ob{ob} {}
+};
+
+/// @brief format argument tag for `type_repr<T>`
+///
+/// Example:
+///
+/// ```cpp
+/// std::format("type: {}", repr_type<T>{});
+/// ```
+template <typename T>
+struct repr_type {};
+
+/// @brief call `func` with a string view for the representation of `ob`,
+/// written to a per-thread scratch buffer
+using object_repr::with_repr_view;
+
+}  // namespace repr_format
+}  // namespace test
+}  // namespace protowire
+
+#if defined(__cpp_lib_format)
+
+template <typename T>
+struct std::formatter<protowire::test::repr_format::repr<T>, char>
+    : std::formatter<std::string_view, char> {
+  template <typename FormatContext>
+  typename FormatContext::iterator format(
+        protowire::test::repr_format::repr<T> const& arg, FormatContext& ctx) const {
+    return protowire::test::repr_format::with_repr_view(
+          arg.ob, [this, &ctx](std::string_view const& repr) {
+            return std::formatter<std::string_view, char>::format(repr, ctx);
+          });
+  }
+};
+
+template <typename T>
+struct std::formatter<protowire::test::repr_format::repr_type<T>, char>
+    : std::formatter<std::string_view, char> {
+  template <typename FormatContext>
+  typename FormatContext::iterator format(
+        protowire::test::repr_format::repr_type<T> const&, FormatContext& ctx) const {
+    return std::formatter<std::string_view, char>::format(
+          protowire::test::type_repr::type_repr<T>::apply(), ctx);
+  }
+};
+
+#endif
+
+#if defined(PROTOWIRE_REPR_FMT)
+
+template <typename T>
+struct fmt::formatter<protowire::test::repr_format::repr<T>, char>
+    : fmt::formatter<fmt::string_view, char> {
+  template <typename FormatContext>
+  typename FormatContext::iterator format(
+        protowire::test::repr_format::repr<T> const& arg, FormatContext& ctx) const {
+    return protowire::test::repr_format::with_repr_view(
+          arg.ob, [this, &ctx](std::string_view const& repr) {
+            return fmt::formatter<fmt::string_view, char>::format(
+                  fmt::string_view{repr.data(), repr.size()}, ctx);
+          });
+  }
+};
+
+template <typename T>
+struct fmt::formatter<protowire::test::repr_format::repr_type<T>, char>
+    : fmt::formatter<fmt::string_view, char> {
+  template <typename FormatContext>
+  typename FormatContext::iterator format(
+        protowire::test::repr_format::repr_type<T> const&, FormatContext& ctx) const {
+    // a std::string returned from apply() is extended to the scope of `result`
+    auto const& result = protowire::test::type_repr::type_repr<T>::apply();
+    std::string_view const repr = result;
+    return fmt::formatter<fmt::string_view, char>::format(
+          fmt::string_view{repr.data(), repr.size()}, ctx);
+  }
+};
+
+#endif
@@ -49,12 +49,38 @@ using protowire::util::type_name::type_name;
 /// @tparam T the type for which `apply()` should produce
 /// a generally human-readable type name.
 ///
+/// Specializations of `type_repr` should return a string view with
+/// static storage duration. Specializations producing a computed
+/// representation may provide a static `build()` function and
+/// return `memoized_repr<type_repr>()` from `apply()`. A specialization
+/// returning a `std::string` or other value convertible to a string view
+/// is also supported, at the cost of a string for each call.
+///
 template <typename T>
 struct type_repr {
 
   /// @brief return a representative string for the type `T`,
-  /// using `type_name<T>::apply()`
-  static std::string const apply() { return type_name<T>::apply(); };
+  /// using `type_name<T>::view()`
+  static std::string_view apply() { return type_name<T>::view(); };
+};
+
+/// @brief true if `type_repr<T>::apply()` returns a value convertible
+/// to `std::string_view`
+template <typename T>
+concept has_type_repr = requires {
+  { type_repr<T>::apply() } -> std::convertible_to<std::string_view>;
+};
+
+/// @brief return the result of `Repr::build()`, computed once
+/// for each `Repr` type.
+///
+/// The result is stored in a function-local static object, such
+/// that initialization is thread-safe and subsequent calls will
+/// not allocate.
+template <typename Repr>
+std::string_view memoized_repr() {
+  static std::string const value = Repr::build();
+  return value;
 };
 
 template <typename F>
@@ -67,27 +93,39 @@ std::string with_repr_stream(F&& func) {
 
 template <typename T>
 std::string prefix_repr(std::string_view const& prefix) {
-  return with_repr_stream([&prefix](std::ostream& b) {
-    b << prefix;
-    b << type_repr<T>::apply();
-  });
+  static_assert(has_type_repr<T>,
+                "type_repr<T>::apply() must return a string view");
+  // a std::string returned from apply() is extended to the scope of `result`
+  auto const& result = type_repr<T>::apply();
+  std::string_view const repr = result;
+  std::string s{};
+  s.reserve(prefix.size() + repr.size());
+  s.append(prefix).append(repr);
+  return s;
 };
 
 template <typename T>
 std::string suffix_repr(std::string_view const& suffix) {
-  return with_repr_stream([&suffix](std::ostream& b) {
-    b << type_repr<T>::apply();
-    b << suffix;
-  });
+  static_assert(has_type_repr<T>,
+                "type_repr<T>::apply() must return a string view");
+  auto const& result = type_repr<T>::apply();
+  std::string_view const repr = result;
+  std::string s{};
+  s.reserve(repr.size() + suffix.size());
+  s.append(repr).append(suffix);
+  return s;
 };
 
 template <typename T>
 std::string infix_repr(std::string_view const& prefix, std::string_view const& suffix) {
-  return with_repr_stream([&prefix, &suffix](std::ostream& b) {
-    b << prefix;
-    b << type_repr<T>::apply();
-    b << suffix;
-  });
+  static_assert(has_type_repr<T>,
+                "type_repr<T>::apply() must return a string view");
+  auto const& result = type_repr<T>::apply();
+  std::string_view const repr = result;
+  std::string s{};
+  s.reserve(prefix.size() + repr.size() + suffix.size());
+  s.append(prefix).append(repr).append(suffix);
+  return s;
 };
 
 template <typename F>
@@ -100,47 +138,58 @@ std::string template_repr(std::string_view const& template_name, F&& func) {
   });
 };
 
-std::string template_repr(std::string_view const& template_name) {
-  return template_repr(template_name, [](std::ostream const&) {});
+inline std::string template_repr(std::string_view const& template_name) {
+  return std::string{template_name}.append("<>");
 };
 
 template <typename First, typename... Rest>
 std::string template_repr(std::string_view const& template_name) {
-  return template_repr(template_name, [](std::ostream& b) {
-    b << type_repr<First>::apply();
-    ((b << ", " << type_repr<Rest>::apply()), ...);
-  });
+  std::string s{template_name};
+  s.append("<").append(type_repr<First>::apply());
+  ((s.append(", ").append(type_repr<Rest>::apply())), ...);
+  s.append(">");
+  return s;
 };
 
 template <typename T>
 struct type_repr<T const> {
-  static std::string const apply() { return suffix_repr<T>(" const"); }
+  static std::string build() { return suffix_repr<T>(" const"); }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <typename T>
 struct type_repr<T*> {
-  static std::string const apply() { return suffix_repr<T>("*"); }
+  static std::string build() { return suffix_repr<T>("*"); }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <typename T>
 struct type_repr<T const*> {
-  static std::string const apply() { return suffix_repr<T>(" const*"); }
+  static std::string build() { return suffix_repr<T>(" const*"); }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <typename T>
 struct type_repr<T&> {
-  static std::string const apply() { return suffix_repr<T>("&"); }
+  static std::string build() { return suffix_repr<T>("&"); }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <typename T>
 struct type_repr<T&&> {
-  static std::string const apply() { return suffix_repr<T>("&&"); }
+  static std::string build() { return suffix_repr<T>("&&"); }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <template <typename...> typename Meta, typename... Args>
 struct meta_prefix {
-  static std::optional<std::string> const apply() {
-    std::string const orig_name = type_name<Meta<Args...>>::apply();
+  static std::optional<std::string_view> const apply() {
+    std::string_view const orig_name = type_name<Meta<Args...>>::view();
     std::size_t const st = orig_name.find('<');
     if (st == orig_name.npos) {
       return std::nullopt;
@@ -152,69 +201,71 @@ struct meta_prefix {
 
 template <template <typename...> typename Meta, typename First, typename... Rest>
 struct type_repr<Meta<First, Rest...>> {
-  static std::string const apply() {
-    std::optional<std::string> const meta_name =
+  static std::string build() {
+    std::optional<std::string_view> const meta_name =
           meta_prefix<Meta, First, Rest...>::apply();
     if (meta_name.has_value()) {
       return template_repr<First, Rest...>(meta_name.value());
     }
     return type_name<Meta<First, Rest...>>::apply();
   }
+
+  static std::string_view apply() { return memoized_repr<type_repr>(); }
 };
 
 template <template <typename...> typename Meta>
 struct type_repr<Meta<>> {
-  static std::string const apply() { return type_name<Meta<>>::apply(); }
+  static std::string_view apply() { return type_name<Meta<>>::view(); }
 };
 
 template <>
 struct type_repr<std::string> {
-  static std::string const apply() { return "std::string"; }
+  static std::string_view apply() { return "std::string"; }
 };
 
 template <>
 struct type_repr<std::wstring> {
-  static std::string const apply() { return "std::wstring"; }
+  static std::string_view apply() { return "std::wstring"; }
 };
 
 template <>
 struct type_repr<std::u8string> {
-  static std::string const apply() { return "std::u8string"; }
+  static std::string_view apply() { return "std::u8string"; }
 };
 
 template <>
 struct type_repr<std::u16string> {
-  static std::string const apply() { return "std::u16string"; }
+  static std::string_view apply() { return "std::u16string"; }
 };
 
 template <>
 struct type_repr<std::u32string> {
-  static std::string const apply() { return "std::u32string"; }
+  static std::string_view apply() { return "std::u32string"; }
 };
 
 template <>
 struct type_repr<std::string_view> {
-  static std::string const apply() { return "std::string_view"; }
+  static std::string_view apply() { return "std::string_view"; }
 };
 
 template <>
 struct type_repr<std::wstring_view> {
-  static std::string const apply() { return "std::wstring_view"; }
+  static std::string_view apply() { return "std::wstring_view"; }
 };
 
 template <>
 struct type_repr<std::u8string_view> {
-  static std::string const apply() { return "std::u8string_view"; }
+  static std::string_view apply() { return "std::u8string_view"; }
 };
 
 template <>
 struct type_repr<std::u16string_view> {
-  static std::string const apply() { return "std::u16string_view"; }
+  static std::string_view apply() { return "std::u16string_view"; }
 };
 
 template <>
 struct type_repr<std::u32string_view> {
-  static std::string const apply() { return "std::u32string_view"; }
+  static std::string_view apply() { return "std::u32string_view"; }
 };
 
 
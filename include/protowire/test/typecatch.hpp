@@ -24,12 +24,15 @@
 
 #pragma once
 
+#include <string>
 #include <type_traits>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <protowire/test/type_repr.hpp>
 #include <protowire/test/object_repr.hpp>
+#include <protowire/test/repr_arena.hpp>
+#include <protowire/test/lazy_capture.hpp>
 #include <protowire/test/equal_op.hpp>
 
 namespace protowire {
@@ -37,6 +40,7 @@ namespace test {
 namespace typecatch {
 
 using protowire::test::type_repr::type_repr;
+using protowire::test::object_repr::repr_inline;
 using protowire::test::object_repr::repr_string;
 using protowire::test::object_repr::object_repr;
 
@@ -69,62 +73,98 @@ struct expect_not_info {
 }  // namespace test
 }  // namespace protowire
 
+// LAZY_UNSCOPED_INFO() renders each lazy message for the next assertion,
+// reporting each message with UNSCOPED_INFO. Each of the following checks
+// uses this in its failure branch. See also PROTOWIRE_LAZY_LISTENER_MESSAGES
+
+#ifndef LAZY_UNSCOPED_INFO
+#define LAZY_UNSCOPED_INFO()                                                             \
+  for (::std::string const& __lazy_message :                                             \
+       ::protowire::test::typecatch::render_lazy_messages()) {                           \
+    UNSCOPED_INFO(__lazy_message);                                                       \
+  }
+#endif
+
 #ifndef CHECK_TYPE
 #define CHECK_TYPE(...)                                                                  \
-  UNSCOPED_INFO("CHECK_TYPE(" << #__VA_ARGS__ << ")");                                   \
-  ::protowire::test::typecatch::expect_info<__VA_ARGS__>::notify();                      \
+  if constexpr (!::std::is_same_v<__VA_ARGS__>) {                                        \
+    UNSCOPED_INFO("CHECK_TYPE(" << #__VA_ARGS__ << ")");                                 \
+    ::protowire::test::typecatch::expect_info<__VA_ARGS__>::notify();                    \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   CHECK(::std::is_same_v<__VA_ARGS__>)
 #endif
 
 #ifndef REQUIRE_TYPE
 #define REQUIRE_TYPE(...)                                                                \
-  UNSCOPED_INFO("REQUIRE_TYPE(" << #__VA_ARGS__ << ")");                                 \
-  ::protowire::test::typecatch::expect_info<__VA_ARGS__>::notify();                      \
+  if constexpr (!::std::is_same_v<__VA_ARGS__>) {                                        \
+    UNSCOPED_INFO("REQUIRE_TYPE(" << #__VA_ARGS__ << ")");                               \
+    ::protowire::test::typecatch::expect_info<__VA_ARGS__>::notify();                    \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   REQUIRE(::std::is_same_v<__VA_ARGS__>)
 #endif
 
 
 #ifndef CHECK_NOT_TYPE
 #define CHECK_NOT_TYPE(...)                                                              \
-  UNSCOPED_INFO("CHECK_NOT_TYPE(" << #__VA_ARGS__ << ")");                               \
-  ::protowire::test::typecatch::expect_not_info<__VA_ARGS__>::notify();                  \
+  if constexpr (::std::is_same_v<__VA_ARGS__>) {                                         \
+    UNSCOPED_INFO("CHECK_NOT_TYPE(" << #__VA_ARGS__ << ")");                             \
+    ::protowire::test::typecatch::expect_not_info<__VA_ARGS__>::notify();                \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   CHECK(!::std::is_same_v<__VA_ARGS__>)
 #endif
 
 
 #ifndef REQUIRE_NOT_TYPE
 #define REQUIRE_NOT_TYPE(...)                                                            \
-  UNSCOPED_INFO("REQUIRE_NOT_TYPE(" << #__VA_ARGS__ << ")");                             \
-  ::protowire::test::typecatch::expect_not_info<__VA_ARGS__>::notify();                  \
+  if constexpr (::std::is_same_v<__VA_ARGS__>) {                                         \
+    UNSCOPED_INFO("REQUIRE_NOT_TYPE(" << #__VA_ARGS__ << ")");                           \
+    ::protowire::test::typecatch::expect_not_info<__VA_ARGS__>::notify();                \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   REQUIRE(!::std::is_same_v<__VA_ARGS__>)
 #endif
 
 
 #ifndef CHECK_TYPE_CONVERTIBLE
 #define CHECK_TYPE_CONVERTIBLE(...)                                                      \
-  UNSCOPED_INFO("CHECK_TYPE_CONVERTIBLE(" << #__VA_ARGS__ << ")");                       \
-  ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                     \
+  if constexpr (!::std::is_convertible_v<__VA_ARGS__>) {                                 \
+    UNSCOPED_INFO("CHECK_TYPE_CONVERTIBLE(" << #__VA_ARGS__ << ")");                     \
+    ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                   \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   CHECK(::std::is_convertible_v<__VA_ARGS__>)
 #endif
 
 #ifndef REQUIRE_TYPE_CONVERTIBLE
 #define REQUIRE_TYPE_CONVERTIBLE(...)                                                    \
-  UNSCOPED_INFO("REQUIRE_TYPE_CONVERTIBLE(" << #__VA_ARGS__ << ")");                     \
-  ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                     \
+  if constexpr (!::std::is_convertible_v<__VA_ARGS__>) {                                 \
+    UNSCOPED_INFO("REQUIRE_TYPE_CONVERTIBLE(" << #__VA_ARGS__ << ")");                   \
+    ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                   \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   REQUIRE(::std::is_convertible_v<__VA_ARGS__>)
 #endif
 
 #ifndef CHECK_TYPE_NOT_CONVERTIBLE
 #define CHECK_TYPE_NOT_CONVERTIBLE(...)                                                  \
-  UNSCOPED_INFO("CHECK_TYPE_NOT_CONVERTIBLE(" << #__VA_ARGS__ << ")");                   \
-  ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                     \
+  if constexpr (::std::is_convertible_v<__VA_ARGS__>) {                                  \
+    UNSCOPED_INFO("CHECK_TYPE_NOT_CONVERTIBLE(" << #__VA_ARGS__ << ")");                 \
+    ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                   \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   CHECK(!::std::is_convertible_v<__VA_ARGS__>)
 #endif
 
 #ifndef REQUIRE_TYPE_NOT_CONVERTIBLE
 #define REQUIRE_TYPE_NOT_CONVERTIBLE(...)                                                \
-  UNSCOPED_INFO("REQUIRE_TYPE_NOT_CONVERTIBLE(" << #__VA_ARGS__ << ")");                 \
-  ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                     \
+  if constexpr (::std::is_convertible_v<__VA_ARGS__>) {                                  \
+    UNSCOPED_INFO("REQUIRE_TYPE_NOT_CONVERTIBLE(" << #__VA_ARGS__ << ")");               \
+    ::protowire::test::typecatch::convert_info<__VA_ARGS__>::notify();                   \
+    LAZY_UNSCOPED_INFO();                                                                \
+  }                                                                                      \
   REQUIRE(!::std::is_convertible_v<__VA_ARGS__>)
 #endif
 
@@ -145,10 +185,43 @@ struct expect_not_info {
 #define RECORD_REPR(...)                                                                 \
   UNSCOPED_INFO(                                                                         \
         #__VA_ARGS__ << " := "                                                           \
-                     << ::protowire::test::object_repr::repr_string(__VA_ARGS__))
+                     << ::protowire::test::object_repr::repr_inline(__VA_ARGS__))
 #endif
 
 #ifndef CAPTURE_REPR
 #define CAPTURE_REPR(...)                                                                \
-  INFO(#__VA_ARGS__ << " := " << ::protowire::test::object_repr::repr_string(__VA_ARGS__))
+  INFO(#__VA_ARGS__ << " := " << ::protowire::test::object_repr::repr_inline(__VA_ARGS__))
+#endif
+
+// lazy messages, rendered only for a failed assertion. For each scoped
+// message, the value is held by reference, or stored for a temporary
+//
+// The messages are reported for a failed typecatch check, or after
+// LAZY_UNSCOPED_INFO(). For any other failed assertion, the messages are
+// reported only with PROTOWIRE_LAZY_LISTENER_MESSAGES, for Catch2 3.x
+
+#ifndef LAZY_RECORD_TYPE
+#define LAZY_RECORD_TYPE(...)                                                            \
+  ::protowire::test::typecatch::lazy_record_type<__VA_ARGS__>(                           \
+        "LAZY_RECORD_TYPE", CATCH_INTERNAL_LINEINFO, #__VA_ARGS__)
+#endif
+
+#ifndef LAZY_CAPTURE_TYPE
+#define LAZY_CAPTURE_TYPE(...)                                                           \
+  ::protowire::test::typecatch::lazy_capture_type<__VA_ARGS__> const                     \
+        INTERNAL_CATCH_UNIQUE_NAME(lazy_capture_type_)(                                  \
+              "LAZY_CAPTURE_TYPE", CATCH_INTERNAL_LINEINFO, #__VA_ARGS__)
+#endif
+
+#ifndef LAZY_RECORD_REPR
+#define LAZY_RECORD_REPR(...)                                                            \
+  ::protowire::test::typecatch::lazy_record("LAZY_RECORD_REPR", CATCH_INTERNAL_LINEINFO, \
+                                            #__VA_ARGS__, (__VA_ARGS__))
+#endif
+
+#ifndef LAZY_CAPTURE_REPR
+#define LAZY_CAPTURE_REPR(...)                                                           \
+  ::protowire::test::typecatch::lazy_capture const INTERNAL_CATCH_UNIQUE_NAME(           \
+        lazy_capture_)("LAZY_CAPTURE_REPR", CATCH_INTERNAL_LINEINFO, #__VA_ARGS__,       \
+                       (__VA_ARGS__))
 #endif
@@ -0,0 +1,74 @@
+/**
+ * @file base64.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief base64 encoding for byte sequences
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace protowire {
+namespace util {
+namespace base64 {
+
+inline constexpr char alphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// @brief return the length of the base64 encoding for `n` bytes, with
+/// padding
+constexpr std::size_t encoded_size(std::size_t n) noexcept {
+  return ((n + 2) / 3) * 4;
+}
+
+/// @brief write the base64 encoding of the `n` bytes at `p`, with padding,
+/// to the `encoded_size(n)` characters at `out`
+///
+/// @return the number of characters written
+inline std::size_t encode(void const* p, std::size_t n, char* out) noexcept {
+  auto const* const pc = static_cast<unsigned char const*>(p);
+  char* o = out;
+  std::size_t i = 0;
+  for (; i + 3 <= n; i += 3) {
+    std::uint32_t const v = (std::uint32_t{pc[i]} << 16) | (std::uint32_t{pc[i + 1]} << 8)
+                            | std::uint32_t{pc[i + 2]};
+    o[0] = alphabet[(v >> 18) & 0x3F];
+    o[1] = alphabet[(v >> 12) & 0x3F];
+    o[2] = alphabet[(v >> 6) & 0x3F];
+    o[3] = alphabet[v & 0x3F];
+    o += 4;
+  }
+  if (std::size_t const rest = n - i; rest != 0) {
+    std::uint32_t const second = (rest == 2) ? pc[i + 1] : 0;
+    std::uint32_t const v = (std::uint32_t{pc[i]} << 16) | (second << 8);
+    o[0] = alphabet[(v >> 18) & 0x3F];
+    o[1] = alphabet[(v >> 12) & 0x3F];
+    o[2] = (rest == 2) ? alphabet[(v >> 6) & 0x3F] : '=';
+    o[3] = '=';
+    o += 4;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+}  // namespace base64
+}  // namespace util
+}  // namespace protowire
@@ -0,0 +1,343 @@
+/**
+ * @file intern.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief concurrent string interning, with stable handles
+ * @version 0.1
+ * @date 2026-01-19
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+#include <protowire/util/lstring.hpp>
+#include <protowire/util/simd.hpp>
+
+namespace protowire {
+namespace util {
+namespace intern {
+
+using lstring::LBasicString;
+
+namespace detail {
+
+/// @brief header for an interned string. The string content follows the
+/// header in the same arena allocation, with a trailing null character.
+struct record {
+  std::uint64_t hash;
+  std::size_t size;
+
+  char const* data() const noexcept { return reinterpret_cast<char const*>(this + 1); }
+};
+
+/// @brief bump allocator for string records. Records are never freed
+/// individually, and remain valid for the lifetime of the arena.
+class arena {
+public:
+  static constexpr std::size_t block_size = 16384;
+
+  /// @brief allocate `n` bytes, aligned for `record`
+  void* allocate(std::size_t n) {
+    n = (n + alignof(record) - 1) & ~(alignof(record) - 1);
+    if (n > available_) {
+      std::size_t const size = std::max(n, block_size);
+      blocks_.push_back(
+            std::make_unique_for_overwrite<record[]>((size / sizeof(record)) + 1));
+      next_ = reinterpret_cast<std::byte*>(blocks_.back().get());
+      available_ = size;
+      reserved_ += size;
+    }
+    void* const p = next_;
+    next_ += n;
+    available_ -= n;
+    return p;
+  }
+
+  /// @brief total bytes reserved for blocks
+  std::size_t reserved() const noexcept { return reserved_; }
+
+private:
+  std::vector<std::unique_ptr<record[]>> blocks_{};
+  std::byte* next_ = nullptr;
+  std::size_t available_ = 0;
+  std::size_t reserved_ = 0;
+};
+
+}  // namespace detail
+
+/// @brief handle for an interned string
+///
+/// Handles for equal strings in the same pool are equal. Comparison and
+/// hashing will use only the handle's address. The string content is
+/// stored in the pool's arena and remains valid for the lifetime of the
+/// pool.
+///
+/// A default-constructed handle is empty and does not compare equal to
+/// any interned string, including the empty string.
+class interned {
+public:
+  constexpr interned() noexcept = default;
+
+  /// @brief return the interned string, or an empty string for an empty handle
+  std::string_view view() const noexcept {
+    return (rec_ == nullptr) ? std::string_view{}
+                             : std::string_view{rec_->data(), rec_->size};
+  }
+
+  /// @brief return the null-terminated string content
+  char const* c_str() const noexcept { return (rec_ == nullptr) ? "" : rec_->data(); }
+
+  std::size_t size() const noexcept { return (rec_ == nullptr) ? 0 : rec_->size; }
+
+  /// @brief return the string hash, as computed with `lstring_hasher<>`
+  std::uint64_t string_hash() const noexcept {
+    return (rec_ == nullptr) ? 0 : rec_->hash;
+  }
+
+  /// @brief return an integer identifier for the handle, unique within the process
+  std::uintptr_t id() const noexcept { return reinterpret_cast<std::uintptr_t>(rec_); }
+
+  explicit operator bool() const noexcept { return rec_ != nullptr; }
+
+  friend bool operator==(interned const&, interned const&) noexcept = default;
+
+private:
+  friend class intern_pool;
+
+  explicit interned(detail::record const* rec) noexcept
+      : rec_{rec} {}
+
+  detail::record const* rec_ = nullptr;
+};
+
+/// @brief statistics for an `intern_pool`
+struct intern_stats {
+  /// @brief number of calls to `intern()`
+  std::size_t lookups = 0;
+  /// @brief number of calls to `intern()` for a string already interned
+  std::size_t hits = 0;
+  /// @brief number of interned strings
+  std::size_t strings = 0;
+  /// @brief total size of interned strings, excluding any trailing null
+  std::size_t string_bytes = 0;
+  /// @brief total size of arena blocks
+  std::size_t arena_bytes = 0;
+
+  double hit_rate() const noexcept {
+    return (lookups == 0) ? 0.0
+                          : static_cast<double>(hits) / static_cast<double>(lookups);
+  }
+};
+
+/// @brief concurrent intern table, sharded by string hash
+///
+/// Each shard has a reader-writer lock, an open-addressed hash table and
+/// an arena for string records. A lookup for a string already interned
+/// will take only a shared lock, for the shard of the string.
+///
+/// Example:
+///
+/// ```cpp
+/// interned const name = global_pool().intern(field_name);
+/// if (name == interned_literal<"id">()) {
+///   ...
+/// }
+/// ```
+class intern_pool {
+public:
+  static constexpr std::size_t shard_count = 16;
+
+  intern_pool() = default;
+  intern_pool(intern_pool const&) = delete;
+  intern_pool& operator=(intern_pool const&) = delete;
+
+  /// @brief return the handle for `s`, interning a copy of `s` if needed
+  interned intern(std::string_view s) {
+    std::uint64_t const h = lstring::lstring_hasher<>{}(s);
+    shard& sh = shards_[h >> (64 - shard_bits)];
+    sh.lookups.fetch_add(1, std::memory_order_relaxed);
+    {
+      std::shared_lock const lock{sh.mutex};
+      if (detail::record const* const rec = sh.find(s, h)) {
+        sh.hits.fetch_add(1, std::memory_order_relaxed);
+        return interned{rec};
+      }
+    }
+    std::unique_lock const lock{sh.mutex};
+    if (detail::record const* const rec = sh.find(s, h)) {
+      sh.hits.fetch_add(1, std::memory_order_relaxed);
+      return interned{rec};
+    }
+    return interned{sh.insert(s, h)};
+  }
+
+  template <std::size_t N>
+  interned intern(LBasicString<N, char> const& s) {
+    return intern(s.view());
+  }
+
+  /// @brief return the handle for `s` if interned, else an empty handle
+  interned find(std::string_view s) const {
+    std::uint64_t const h = lstring::lstring_hasher<>{}(s);
+    shard const& sh = shards_[h >> (64 - shard_bits)];
+    std::shared_lock const lock{sh.mutex};
+    return interned{sh.find(s, h)};
+  }
+
+  intern_stats stats() const {
+    intern_stats st{};
+    for (shard const& sh : shards_) {
+      st.lookups += sh.lookups.load(std::memory_order_relaxed);
+      st.hits += sh.hits.load(std::memory_order_relaxed);
+      std::shared_lock const lock{sh.mutex};
+      st.strings += sh.count;
+      st.string_bytes += sh.string_bytes;
+      st.arena_bytes += sh.storage.reserved();
+    }
+    return st;
+  }
+
+private:
+  static constexpr unsigned shard_bits = std::bit_width(shard_count - 1);
+  static_assert(std::has_single_bit(shard_count));
+
+  struct alignas(64) shard {
+    mutable std::shared_mutex mutex{};
+    std::atomic<std::size_t> lookups{0};
+    std::atomic<std::size_t> hits{0};
+    std::vector<detail::record const*> slots{};
+    std::size_t count = 0;
+    std::size_t string_bytes = 0;
+    detail::arena storage{};
+
+    detail::record const* find(std::string_view s, std::uint64_t h) const noexcept {
+      if (slots.empty()) {
+        return nullptr;
+      }
+      std::size_t const mask = slots.size() - 1;
+      for (std::size_t i = h & mask;; i = (i + 1) & mask) {
+        detail::record const* const rec = slots[i];
+        if (rec == nullptr) {
+          return nullptr;
+        }
+        if (rec->hash == h && rec->size == s.size()
+            && simd::equal(rec->data(), s.data(), s.size())) {
+          return rec;
+        }
+      }
+    }
+
+    detail::record const* insert(std::string_view s, std::uint64_t h) {
+      if ((count + 1) * 2 > slots.size()) {
+        grow();
+      }
+      void* const p = storage.allocate(sizeof(detail::record) + s.size() + 1);
+      auto* const rec = ::new (p) detail::record{h, s.size()};
+      char* const chars = reinterpret_cast<char*>(rec + 1);
+      std::memcpy(chars, s.data(), s.size());
+      chars[s.size()] = '\0';
+      place(slots, rec);
+      ++count;
+      string_bytes += s.size();
+      return rec;
+    }
+
+    void grow() {
+      std::vector<detail::record const*> next(std::max<std::size_t>(16, slots.size() * 2),
+                                              nullptr);
+      for (detail::record const* const rec : slots) {
+        if (rec != nullptr) {
+          place(next, rec);
+        }
+      }
+      slots.swap(next);
+    }
+
+    static void place(std::vector<detail::record const*>& table,
+                      detail::record const* rec) noexcept {
+      std::size_t const mask = table.size() - 1;
+      std::size_t i = rec->hash & mask;
+      while (table[i] != nullptr) {
+        i = (i + 1) & mask;
+      }
+      table[i] = rec;
+    }
+  };
+
+  std::array<shard, shard_count> shards_{};
+};
+
+/// @brief return the process-wide intern pool
+///
+/// The pool is constructed on first use, such that it may be used
+/// during static initialization.
+inline intern_pool& global_pool() {
+  static intern_pool pool{};
+  return pool;
+}
+
+/// @brief return the handle for `s` in the global pool
+inline interned intern(std::string_view s) {
+  return global_pool().intern(s);
+}
+
+/// @brief return the handle for the literal `S` in the global pool,
+/// interned once for each literal
+template <LBasicString S>
+  requires (std::is_same_v<typename decltype(S)::char_type, char>)
+interned interned_literal() {
+  static interned const handle = global_pool().intern(S.view());
+  return handle;
+}
+
+/// @brief pre-seed the global pool with the literals `Names`
+///
+/// Example, at namespace scope:
+///
+/// ```cpp
+/// inline intern_seed<"id", "name", "email"> const field_names{};
+/// ```
+template <LBasicString... Names>
+struct intern_seed {
+  intern_seed() { (interned_literal<Names>(), ...); }
+};
+
+}  // namespace intern
+}  // namespace util
+}  // namespace protowire
+
+template <>
+struct std::hash<protowire::util::intern::interned> {
+  std::size_t operator()(protowire::util::intern::interned const& h) const noexcept {
+    return std::hash<std::uintptr_t>{}(h.id());
+  }
+};
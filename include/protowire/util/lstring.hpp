@@ -25,6 +25,8 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <compare>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -32,16 +34,178 @@
 #include <cstring>
 #include <locale>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include <boost/mpl/size_t.hpp>
 
+#include <protowire/util/simd.hpp>
+
 namespace protowire {
 namespace util {
 namespace lstring {
 
 namespace mpl = boost::mpl;
 
+namespace detail {
+
+/// @brief return the index of the first differing character in `a` and `b`,
+/// within `n` characters, or `n` if the character sequences are equal
+template <typename CharT>
+constexpr std::size_t chars_mismatch(CharT const* a, CharT const* b,
+                                     std::size_t n) noexcept {
+  if (std::is_constant_evaluated()) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!std::char_traits<CharT>::eq(a[i], b[i])) {
+        return i;
+      }
+    }
+    return n;
+  }
+  return simd::mismatch(a, b, n * sizeof(CharT)) / sizeof(CharT);
+}
+
+/// @brief lexicographic comparison for character sequences, as with
+/// `std::char_traits<CharT>`
+template <typename CharT>
+constexpr std::strong_ordering chars_compare(CharT const* a, std::size_t na,
+                                             CharT const* b, std::size_t nb) noexcept {
+  std::size_t const n = std::min(na, nb);
+  std::size_t const i = chars_mismatch(a, b, n);
+  if (i < n) {
+    return std::char_traits<CharT>::lt(a[i], b[i]) ? std::strong_ordering::less
+                                                    : std::strong_ordering::greater;
+  }
+  return na <=> nb;
+}
+
+/// @brief equality for character sequences with the character traits `Traits`
+template <typename CharT, typename Traits>
+constexpr bool chars_equal(CharT const* a, std::size_t na, CharT const* b,
+                           std::size_t nb) noexcept {
+  if (na != nb) {
+    return false;
+  }
+  if constexpr (std::is_same_v<Traits, std::char_traits<CharT>>) {
+    if (std::is_constant_evaluated()) {
+      return chars_mismatch(a, b, na) == na;
+    }
+    return simd::equal(a, b, na * sizeof(CharT));
+  } else {
+    return Traits::compare(a, b, na) == 0;
+  }
+}
+
+/// @brief return the byte at offset `i` for the little-endian encoding of
+/// the code units in `s`
+template <typename CharT>
+constexpr std::uint8_t byte_at(CharT const* s, std::size_t i) noexcept {
+  using unit_type = std::make_unsigned_t<CharT>;
+  return static_cast<std::uint8_t>(static_cast<unit_type>(s[i / sizeof(CharT)])
+                                   >> (8 * (i % sizeof(CharT))));
+}
+
+/// @brief return `sizeof(T)` bytes at offset `i` of `s`, as a little-endian value
+template <typename T, typename CharT>
+constexpr T read_le(CharT const* s, std::size_t i) noexcept {
+  if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+    T value;
+    std::memcpy(&value, reinterpret_cast<unsigned char const*>(s) + i, sizeof(T));
+    return value;
+  }
+  T value = 0;
+  for (std::size_t n = 0; n < sizeof(T); ++n) {
+    value |= static_cast<T>(byte_at(s, i + n)) << (8 * n);
+  }
+  return value;
+}
+
+}  // namespace detail
+
+/// @brief FNV-1a hash (64 bit) for character sequences
+///
+/// Character sequences are hashed as the little-endian encoding of each
+/// code unit, such that a hash value is consistent across platforms
+/// and between constant and runtime evaluation.
+struct fnv1a_hash {
+  template <typename CharT>
+  static constexpr std::uint64_t apply(CharT const* s, std::size_t n) noexcept {
+    std::uint64_t h = 0xCBF29CE484222325u;
+    for (std::size_t i = 0; i < n * sizeof(CharT); ++i) {
+      h ^= detail::byte_at(s, i);
+      h *= 0x100000001B3u;
+    }
+    return h;
+  }
+};
+
+/// @brief XXH64 hash, with seed 0, for character sequences
+///
+/// Character sequences are hashed as for `fnv1a_hash`. For longer
+/// strings, this will generally be faster than `fnv1a_hash` at runtime
+struct xxh64_hash {
+  static constexpr std::uint64_t p1 = 0x9E3779B185EBCA87u;
+  static constexpr std::uint64_t p2 = 0xC2B2AE3D27D4EB4Fu;
+  static constexpr std::uint64_t p3 = 0x165667B19E3779F9u;
+  static constexpr std::uint64_t p4 = 0x85EBCA77C2B2AE63u;
+  static constexpr std::uint64_t p5 = 0x27D4EB2F165667C5u;
+
+  static constexpr std::uint64_t round(std::uint64_t acc, std::uint64_t input) noexcept {
+    return std::rotl(acc + (input * p2), 31) * p1;
+  }
+
+  static constexpr std::uint64_t merge(std::uint64_t acc, std::uint64_t v) noexcept {
+    return ((acc ^ round(0, v)) * p1) + p4;
+  }
+
+  template <typename CharT>
+  static constexpr std::uint64_t apply(CharT const* s, std::size_t n) noexcept {
+    std::size_t const len = n * sizeof(CharT);
+    std::size_t i = 0;
+    std::uint64_t h;
+    if (len >= 32) {
+      std::uint64_t v1 = p1 + p2;
+      std::uint64_t v2 = p2;
+      std::uint64_t v3 = 0;
+      std::uint64_t v4 = -p1;
+      for (; i + 32 <= len; i += 32) {
+        v1 = round(v1, detail::read_le<std::uint64_t>(s, i));
+        v2 = round(v2, detail::read_le<std::uint64_t>(s, i + 8));
+        v3 = round(v3, detail::read_le<std::uint64_t>(s, i + 16));
+        v4 = round(v4, detail::read_le<std::uint64_t>(s, i + 24));
+      }
+      h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+      h = merge(merge(merge(merge(h, v1), v2), v3), v4);
+    } else {
+      h = p5;
+    }
+    h += len;
+    for (; i + 8 <= len; i += 8) {
+      h ^= round(0, detail::read_le<std::uint64_t>(s, i));
+      h = (std::rotl(h, 27) * p1) + p4;
+    }
+    if (i + 4 <= len) {
+      h ^= static_cast<std::uint64_t>(detail::read_le<std::uint32_t>(s, i)) * p1;
+      h = (std::rotl(h, 23) * p2) + p3;
+      i += 4;
+    }
+    for (; i < len; ++i) {
+      h ^= detail::byte_at(s, i) * p5;
+      h = std::rotl(h, 11) * p1;
+    }
+    h ^= h >> 33;
+    h *= p2;
+    h ^= h >> 29;
+    h *= p3;
+    h ^= h >> 32;
+    return h;
+  }
+};
+
+/// @brief default hash for literal strings and `lstring_hasher`
+using default_hash = fnv1a_hash;
+
 /// @brief Literal string type
 ///
 /// @tparam N Size of the literal string, generally including a trailing
@@ -50,20 +214,64 @@ namespace mpl = boost::mpl;
 /// @tparam CharT Character type for the literal string, generally may
 /// be inferred
 ///  though the constructor.
+///
+/// Comparisons are by value, for the string content excluding any
+/// trailing null character. Ordering is lexicographic, as with
+/// `std::char_traits<CharT>`. At runtime, comparisons will use the
+/// byte comparison in `protowire::util::simd`.
 template <std::size_t N, typename CharT>
 struct LBasicString {
   using char_type = CharT;
   using data_type = CharT[N];
   using count_type = mpl::size_t<N>;
+  using view_type = std::basic_string_view<CharT>;
 
   CharT data[N];
 
+  /// @brief construct a string of `N` null characters
+  constexpr LBasicString() noexcept
+      : data{} {}
+
   constexpr LBasicString(CharT const (&chars)[N]) noexcept {
     std::copy_n(chars, N, data);
   }
 
   constexpr data_type const& get_value() const { return data; }
 
+  /// @brief return the number of characters, excluding any trailing null character
+  constexpr std::size_t size() const noexcept {
+    return (N > 0 && data[N - 1] == CharT{}) ? N - 1 : N;
+  }
+
+  /// @brief return a string view for the string content, excluding any
+  /// trailing null character
+  constexpr view_type view() const noexcept { return view_type{data, size()}; }
+
+  /// @brief return the hash of the string content, excluding any trailing
+  /// null character.
+  ///
+  /// For a literal string as a template parameter object, see also
+  /// `lstring_hash_v`
+  ///
+  /// @tparam Hash hash policy, e.g `fnv1a_hash` or `xxh64_hash`
+  template <typename Hash = default_hash>
+  constexpr std::uint64_t hash() const noexcept {
+    return Hash::apply(data, size());
+  }
+
+  /// @brief return the substring of at most `Len` characters at `Pos`,
+  /// as a new literal string with a trailing null character
+  ///
+  /// The string is assumed to be null-terminated, as for a string literal
+  template <std::size_t Pos, std::size_t Len = std::size_t(-1)>
+    requires (N > 0 && Pos < N)
+  constexpr auto substr() const noexcept {
+    constexpr std::size_t count = std::min(Len, N - 1 - Pos);
+    LBasicString<count + 1, CharT> s{};
+    std::copy_n(data + Pos, count, s.data);
+    return s;
+  }
+
   template <typename T>
     requires (std::is_convertible_v<data_type, T>)
   T constexpr pack() const {
@@ -71,62 +279,147 @@ struct LBasicString {
   }
 
   template <std::size_t ExtN>
-    requires (ExtN == N)
-  bool operator==(LBasicString<ExtN, CharT> const& ext) const {
-    return data == ext.data;
+  constexpr bool operator==(LBasicString<ExtN, CharT> const& ext) const noexcept {
+    if constexpr (ExtN != N) {
+      return false;
+    } else {
+      return detail::chars_equal<CharT, std::char_traits<CharT>>(data, N, ext.data, N);
+    }
+  }
+
+  template <typename Traits, typename Alloc>
+  constexpr bool operator==(
+        std::basic_string<CharT, Traits, Alloc> const& s) const noexcept {
+    return detail::chars_equal<CharT, Traits>(s.data(), s.size(), data, size());
+  }
+
+  template <typename Traits>
+  constexpr bool operator==(
+        std::basic_string_view<CharT, Traits> const& s) const noexcept {
+    return detail::chars_equal<CharT, Traits>(s.data(), s.size(), data, size());
   }
 
   template <std::size_t ExtN>
-    requires (ExtN != N)
-  bool operator==(LBasicString<ExtN, CharT> const&) const {
-    return false;
+  constexpr std::strong_ordering operator<=>(
+        LBasicString<ExtN, CharT> const& ext) const noexcept {
+    return detail::chars_compare(data, size(), ext.data, ext.size());
   }
 
-  template <typename Traits, typename Alloc>
-  bool operator==(std::basic_string<CharT, Traits, Alloc> const& s) const {
-    if ((s.size() + 1) == N) {
-      return Traits::compare(s.data(), data, N) == 0;
-    }
-    return false;
+  template <typename Alloc>
+  constexpr std::strong_ordering operator<=>(
+        std::basic_string<CharT, std::char_traits<CharT>, Alloc> const& s)
+        const noexcept {
+    return detail::chars_compare(data, size(), s.data(), s.size());
   }
 
-  template <typename Traits>
-  bool operator==(std::basic_string_view<CharT, Traits> const& s) const {
-    if ((s.size() + 1) == N) {
-      return Traits::compare(s.data(), data, N) == 0;
-    }
-    return false;
+  constexpr std::strong_ordering operator<=>(view_type const& s) const noexcept {
+    return detail::chars_compare(data, size(), s.data(), s.size());
   }
 };
 
-template <std::size_t N>
-struct LString : LBasicString<N, char> {
-  using LBasicString<N, char>::data;
+/// @brief concatenate the literal strings `a` and `b`
+///
+/// Each operand is assumed to be null-terminated, as for a string
+/// literal. The result will have one trailing null character.
+///
+/// Example:
+///
+/// ```cpp
+/// constexpr auto name = "std::optional<" + LString{"int"} + ">";
+/// ```
+template <std::size_t N, std::size_t M, typename CharT>
+  requires (N > 0 && M > 0)
+constexpr LBasicString<N + M - 1, CharT> operator+(
+      LBasicString<N, CharT> const& a, LBasicString<M, CharT> const& b) noexcept {
+  LBasicString<N + M - 1, CharT> s{};
+  std::copy_n(a.data, N - 1, s.data);
+  std::copy_n(b.data, M, s.data + N - 1);
+  return s;
+}
 
-  constexpr LString(char const (&chars)[N]) noexcept
-      : LBasicString<N, char>(chars) {};
+template <std::size_t N, std::size_t M, typename CharT>
+constexpr auto operator+(LBasicString<N, CharT> const& a, CharT const (&b)[M]) noexcept {
+  return a + LBasicString<M, CharT>{b};
+}
 
-  template <typename Traits, typename Alloc>
-  bool operator==(std::basic_string<char, Traits, Alloc> const& s) const {
-    return ((s.size() + 1) == N) && (std::strncmp(s.c_str(), data, N) == 0);
-  }
+template <std::size_t N, std::size_t M, typename CharT>
+constexpr auto operator+(CharT const (&a)[N], LBasicString<M, CharT> const& b) noexcept {
+  return LBasicString<N, CharT>{a} + b;
+}
 
-  template <typename Traits>
-  bool operator==(std::basic_string_view<char, Traits> const& s) const {
-    return ((s.size() + 1) == N) && (std::strncmp(s.data(), data, N) == 0);
+/// @brief concatenate the literal strings `parts`, with the separator `Sep`
+///
+/// Example:
+///
+/// ```cpp
+/// constexpr auto args = join<", ">(LString{"int"}, LString{"char"});
+/// ```
+template <LBasicString Sep, typename CharT = typename decltype(Sep)::char_type,
+          std::size_t... N>
+  requires (std::is_same_v<typename decltype(Sep)::char_type, CharT> && ((N > 0) && ...))
+constexpr auto join(LBasicString<N, CharT> const&... parts) noexcept {
+  constexpr std::size_t count = sizeof...(N);
+  constexpr std::size_t size =
+        ((N - 1) + ... + 0) + ((count > 0) ? (count - 1) * Sep.size() : 0);
+  LBasicString<size + 1, CharT> s{};
+  if constexpr (count > 0) {
+    std::size_t i = 0;
+    auto const append = [&s, &i](CharT const* chars, std::size_t n) {
+      std::copy_n(chars, n, s.data + i);
+      i += n;
+    };
+    bool first = true;
+    ((first ? void(first = false) : append(Sep.data, Sep.size()),
+      append(parts.data, N - 1)),
+     ...);
   }
+  return s;
+}
 
-  template <std::size_t ExtN>
-    requires (ExtN == N)
-  bool operator==(LString<ExtN> const& ext) const {
-    return data == ext.data;
+/// @brief decimal representation of the integer `V`, as a literal string
+///
+/// Example:
+///
+/// ```cpp
+/// static_assert(to_lstring<-42>() == std::string_view{"-42"});
+/// ```
+template <auto V, typename CharT = char>
+  requires (std::is_integral_v<decltype(V)> && !std::is_same_v<decltype(V), bool>)
+constexpr auto to_lstring() noexcept {
+  using unsigned_type = std::make_unsigned_t<decltype(V)>;
+  constexpr bool negative = (V < 0);
+  constexpr unsigned_type magnitude =
+        negative ? unsigned_type(0) - static_cast<unsigned_type>(V)
+                 : static_cast<unsigned_type>(V);
+  constexpr std::size_t digits = [] {
+    std::size_t n = 1;
+    for (unsigned_type m = magnitude; m >= 10; m /= 10) {
+      ++n;
+    }
+    return n;
+  }();
+  LBasicString<digits + (negative ? 2 : 1), CharT> s{};
+  std::size_t i = digits + (negative ? 1 : 0);
+  unsigned_type m = magnitude;
+  do {
+    s.data[--i] = static_cast<CharT>('0' + (m % 10));
+    m /= 10;
+  } while (m != 0);
+  if constexpr (negative) {
+    s.data[0] = static_cast<CharT>('-');
   }
+  return s;
+}
 
-  template <std::size_t ExtN>
-    requires (ExtN != N)
-  bool operator==(LString<ExtN> const&) const {
-    return false;
-  }
+template <std::size_t N>
+struct LString : LBasicString<N, char> {
+  using LBasicString<N, char>::data;
+
+  constexpr LString(char const (&chars)[N]) noexcept
+      : LBasicString<N, char>(chars) {};
+
+  constexpr LString(LBasicString<N, char> const& s) noexcept
+      : LBasicString<N, char>(s) {};
 };
 
 template <std::size_t N>
@@ -136,31 +429,58 @@ struct WString : LBasicString<N, wchar_t> {
   constexpr WString(wchar_t const (&chars)[N]) noexcept
       : LBasicString<N, wchar_t>(chars) {};
 
-  template <typename Traits, typename Alloc>
-  bool operator==(std::basic_string<wchar_t, Traits, Alloc> const& s) const {
-    return ((s.size() + 1) == N) && (std::wcsncmp(s.c_str(), data, N) == 0);
+  constexpr WString(LBasicString<N, wchar_t> const& s) noexcept
+      : LBasicString<N, wchar_t>(s) {};
+};
+
+template <std::size_t N>
+using U8String = LBasicString<N, char8_t>;
+
+/// @brief compile-time hash value for the literal string `S`
+///
+/// Example:
+///
+/// ```cpp
+/// switch (lstring_hasher<>{}(name)) {
+/// case lstring_hash_v<"field_a">:
+///   return (LString{"field_a"} == name) ? field_a : unknown;
+/// ...
+/// }
+/// ```
+template <LBasicString S, typename Hash = default_hash>
+inline constexpr std::uint64_t lstring_hash_v = S.template hash<Hash>();
+
+/// @brief runtime hash function object, consistent with `LBasicString::hash()`
+///
+/// This hash function object is transparent, e.g for heterogeneous
+/// lookup in unordered containers with `std::string` keys.
+template <typename Hash = default_hash>
+struct lstring_hasher {
+  using is_transparent = void;
+
+  template <typename CharT, typename Traits>
+  constexpr std::uint64_t operator()(
+        std::basic_string_view<CharT, Traits> const& s) const noexcept {
+    return Hash::apply(s.data(), s.size());
   }
 
-  template <typename Traits>
-  bool operator==(std::basic_string_view<wchar_t, Traits> const& s) const {
-    return ((s.size() + 1) == N) && (std::wcsncmp(s.data(), data, N) == 0);
+  template <typename CharT, typename Traits, typename Alloc>
+  constexpr std::uint64_t operator()(
+        std::basic_string<CharT, Traits, Alloc> const& s) const noexcept {
+    return Hash::apply(s.data(), s.size());
   }
 
-  template <std::size_t ExtN>
-    requires (ExtN == N)
-  bool operator==(WString<ExtN> const& ext) const {
-    return data == ext.data;
+  template <typename CharT>
+  constexpr std::uint64_t operator()(CharT const* s) const noexcept {
+    return Hash::apply(s, std::char_traits<CharT>::length(s));
   }
 
-  template <std::size_t ExtN>
-    requires (ExtN != N)
-  bool operator==(WString<ExtN> const&) const {
-    return false;
+  template <std::size_t N, typename CharT>
+  constexpr std::uint64_t operator()(LBasicString<N, CharT> const& s) const noexcept {
+    return s.template hash<Hash>();
   }
 };
 
-template <std::size_t N>
-using U8String = LBasicString<N, char8_t>;
 
 
 }  // namespace lstring
@@ -0,0 +1,270 @@
+/**
+ * @file lstring_map.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief immutable maps keyed by literal strings, with a compile-time perfect hash
+ * @version 0.1
+ * @date 2026-01-16
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include <protowire/util/lstring.hpp>
+
+namespace protowire {
+namespace util {
+namespace lstring {
+
+/// @brief key and value for an entry in `lstring_map`
+///
+/// @tparam N size of the literal key, including the trailing null character
+/// @tparam CharT character type for the key
+/// @tparam V value type. This must be a structural type, for use as a
+/// template parameter
+template <std::size_t N, typename CharT, typename V>
+struct lstring_kv {
+  using char_type = CharT;
+  using value_type = V;
+
+  LBasicString<N, CharT> key;
+  V value;
+
+  constexpr lstring_kv(CharT const (&chars)[N], V value) noexcept(
+        std::is_nothrow_copy_constructible_v<V>)
+      : key{chars}, value{value} {}
+};
+
+namespace detail {
+
+/// @brief first-level bucket for a key hash `h`, with `2^bits` buckets
+constexpr std::size_t phf_bucket(std::uint64_t h, unsigned bits) noexcept {
+  return static_cast<std::size_t>((h * 0xC2B2AE3D27D4EB4Fu) >> (64 - bits));
+}
+
+/// @brief table slot for a key hash `h` with displacement `d`, for a
+/// table of `2^bits` slots
+constexpr std::size_t phf_slot(std::uint64_t h, std::uint32_t d, unsigned bits) noexcept {
+  std::uint64_t const x = (h ^ (d * 0x9E3779B97F4A7C15u)) * 0xFF51AFD7ED558CCDu;
+  return static_cast<std::size_t>(x >> (64 - bits));
+}
+
+/// @brief hash-and-displace table for `N` keys, with `2^SlotBits` slots
+/// and `2^BucketBits` buckets
+///
+/// Each slot holds the index of a key, or `N` for an empty slot
+template <std::size_t N, unsigned SlotBits, unsigned BucketBits>
+struct phf_table {
+  static constexpr std::size_t slot_count = std::size_t{1} << SlotBits;
+  static constexpr std::size_t bucket_count = std::size_t{1} << BucketBits;
+
+  std::array<std::uint32_t, bucket_count> displace{};
+  std::array<std::size_t, slot_count> slots{};
+};
+
+/// @brief upper bound for the displacement search, per bucket
+inline constexpr std::uint32_t phf_search_limit = 1u << 16;
+
+/// @brief construct a perfect hash table for the key hashes `hashes`
+///
+/// Buckets are placed in order of decreasing size. For each bucket, the
+/// first displacement mapping every key in the bucket to a distinct empty
+/// slot is recorded.
+///
+/// @throws std::logic_error for duplicate key hashes, or when no
+/// displacement is found. In a constant expression, this is a
+/// compile-time error.
+template <unsigned SlotBits, unsigned BucketBits, std::size_t N>
+constexpr phf_table<N, SlotBits, BucketBits> phf_build(
+      std::array<std::uint64_t, N> const& hashes) {
+  using table_type = phf_table<N, SlotBits, BucketBits>;
+  table_type table{};
+  table.slots.fill(N);
+
+  std::array<std::size_t, N> bucket_of{};
+  std::array<std::size_t, table_type::bucket_count> bucket_size{};
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = i + 1; j < N; ++j) {
+      if (hashes[i] == hashes[j]) {
+        throw std::logic_error("lstring_map: duplicate key");
+      }
+    }
+    bucket_of[i] = phf_bucket(hashes[i], BucketBits);
+    ++bucket_size[bucket_of[i]];
+  }
+
+  std::array<std::size_t, N> members{};
+  std::array<std::size_t, N> placed{};
+  for (std::size_t size = N; size > 0; --size) {
+    for (std::size_t b = 0; b < table_type::bucket_count; ++b) {
+      if (bucket_size[b] != size) {
+        continue;
+      }
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < N; ++i) {
+        if (bucket_of[i] == b) {
+          members[count++] = i;
+        }
+      }
+      bool found = false;
+      for (std::uint32_t d = 0; !found && d < phf_search_limit; ++d) {
+        found = true;
+        for (std::size_t k = 0; found && k < count; ++k) {
+          std::size_t const slot = phf_slot(hashes[members[k]], d, SlotBits);
+          found = (table.slots[slot] == N);
+          for (std::size_t p = 0; found && p < k; ++p) {
+            found = (placed[p] != slot);
+          }
+          placed[k] = slot;
+        }
+        if (found) {
+          table.displace[b] = d;
+          for (std::size_t k = 0; k < count; ++k) {
+            table.slots[placed[k]] = members[k];
+          }
+        }
+      }
+      if (!found) {
+        throw std::logic_error("lstring_map: no displacement found");
+      }
+    }
+  }
+  return table;
+}
+
+}  // namespace detail
+
+/// @brief immutable map of literal string keys, using a perfect hash
+/// computed at compile time
+///
+/// @tparam Hash hash policy, e.g `fnv1a_hash` or `xxh64_hash`
+/// @tparam Entries `lstring_kv` entries for the map. Each key should
+/// be unique, and all keys should have the same character type.
+///
+/// A lookup will compute one hash for the key, then compare the key with
+/// at most one entry. Lookups do not allocate.
+///
+/// Example:
+///
+/// ```cpp
+/// using fields = lstring_map<{"id", 1}, {"name", 2}, {"email", 3}>;
+///
+/// if (auto const* field = fields::find(name)) {
+///   ...
+/// }
+/// ```
+template <typename Hash, lstring_kv... Entries>
+class basic_lstring_map {
+  static_assert(sizeof...(Entries) > 0, "lstring_map requires at least one entry");
+
+  using first_entry =
+        std::tuple_element_t<0, std::tuple<std::remove_cvref_t<decltype(Entries)>...>>;
+
+public:
+  using char_type = typename first_entry::char_type;
+  using value_type = std::common_type_t<
+        typename std::remove_cvref_t<decltype(Entries)>::value_type...>;
+  using view_type = std::basic_string_view<char_type>;
+
+  static_assert(
+        (std::is_same_v<typename std::remove_cvref_t<decltype(Entries)>::char_type,
+                        char_type>
+         && ...),
+        "lstring_map keys should have a common character type");
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// @brief keys, in the order of declaration
+  static constexpr std::array<view_type, sizeof...(Entries)> keys{Entries.key.view()...};
+
+  /// @brief values, in the order of declaration
+  static constexpr std::array<value_type, sizeof...(Entries)> values{
+        static_cast<value_type>(Entries.value)...};
+
+  static constexpr std::size_t size() noexcept { return sizeof...(Entries); }
+
+  /// @brief return the index of `key` in `keys`, or `npos`
+  static constexpr std::size_t index_of(view_type key) noexcept {
+    std::uint64_t const h = Hash::apply(key.data(), key.size());
+    std::size_t const i = table.slots[detail::phf_slot(
+          h, table.displace[detail::phf_bucket(h, bucket_bits)], slot_bits)];
+    if (i < size()
+        && detail::chars_equal<char_type, std::char_traits<char_type>>(
+              keys[i].data(), keys[i].size(), key.data(), key.size())) {
+      return i;
+    }
+    return npos;
+  }
+
+  static constexpr bool contains(view_type key) noexcept { return index_of(key) != npos; }
+
+  /// @brief return a pointer to the value for `key`, or `nullptr`
+  static constexpr value_type const* find(view_type key) noexcept {
+    std::size_t const i = index_of(key);
+    return (i == npos) ? nullptr : &values[i];
+  }
+
+  /// @brief return the value for `key`
+  /// @throws std::out_of_range if `key` is not in the map
+  static constexpr value_type const& at(view_type key) {
+    std::size_t const i = index_of(key);
+    if (i == npos) {
+      throw std::out_of_range("lstring_map::at: key not found");
+    }
+    return values[i];
+  }
+
+  /// @brief return the value for the literal `Key`, checked at compile time
+  template <LBasicString Key>
+  static constexpr value_type const& get() noexcept {
+    constexpr std::size_t i = index_of(Key.view());
+    static_assert(i != npos, "lstring_map::get: key not found");
+    return values[i];
+  }
+
+private:
+  static constexpr unsigned slot_bits = std::bit_width(
+        std::bit_ceil(sizeof...(Entries) + (sizeof...(Entries) / 4) + 1) - 1);
+  static constexpr unsigned bucket_bits =
+        std::bit_width(std::bit_ceil((sizeof...(Entries) / 2) + 2) - 1);
+
+  static constexpr std::array<std::uint64_t, sizeof...(Entries)> hashes{
+        Entries.key.template hash<Hash>()...};
+
+  static constexpr detail::phf_table<sizeof...(Entries), slot_bits, bucket_bits> table =
+        detail::phf_build<slot_bits, bucket_bits>(hashes);
+};
+
+/// @brief `basic_lstring_map` using `xxh64_hash`
+///
+/// For runtime lookups, `xxh64_hash` will hash the key as 8-byte words
+template <lstring_kv... Entries>
+using lstring_map = basic_lstring_map<xxh64_hash, Entries...>;
+
+}  // namespace lstring
+}  // namespace util
+}  // namespace protowire
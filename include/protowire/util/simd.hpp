@@ -0,0 +1,429 @@
+/**
+ * @file simd.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief SIMD kernels for byte sequences, with scalar fallback
+ * @version 0.1
+ * @date 2026-01-14
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Kernels are selected at compile time, from the target instruction
+// set of the translation unit. Define PROTOWIRE_SIMD_SCALAR to use
+// only the scalar implementations.
+
+#if !defined(PROTOWIRE_SIMD_SCALAR) && defined(__AVX2__)
+#define PROTOWIRE_SIMD_AVX2 1
+#else
+#define PROTOWIRE_SIMD_AVX2 0
+#endif
+
+#if !defined(PROTOWIRE_SIMD_SCALAR)                                                      \
+      && (defined(__SSE2__) || defined(_M_X64)                                           \
+          || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PROTOWIRE_SIMD_SSE2 1
+#else
+#define PROTOWIRE_SIMD_SSE2 0
+#endif
+
+#if PROTOWIRE_SIMD_AVX2 || PROTOWIRE_SIMD_SSE2
+#include <immintrin.h>
+#endif
+
+namespace protowire {
+namespace util {
+namespace simd {
+
+namespace detail {
+
+template <typename T>
+inline T load(unsigned char const* p) noexcept {
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+#if PROTOWIRE_SIMD_AVX2
+/// @brief bit mask of equal bytes, for 32 bytes at `pa` and `pb`
+inline std::uint32_t eq_mask32(unsigned char const* pa,
+                               unsigned char const* pb) noexcept {
+  __m256i const va = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pa));
+  __m256i const vb = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pb));
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+}
+
+/// @brief bitwise difference, for 32 bytes at `pa` and `pb`
+inline __m256i diff32(unsigned char const* pa, unsigned char const* pb) noexcept {
+  return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(pa)),
+                          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pb)));
+}
+#endif
+
+#if PROTOWIRE_SIMD_SSE2
+/// @brief bit mask of equal bytes, for 16 bytes at `pa` and `pb`
+inline std::uint32_t eq_mask16(unsigned char const* pa,
+                               unsigned char const* pb) noexcept {
+  __m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pa));
+  __m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pb));
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+}
+
+/// @brief bitwise difference, for 16 bytes at `pa` and `pb`
+inline __m128i diff16(unsigned char const* pa, unsigned char const* pb) noexcept {
+  return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(pa)),
+                       _mm_loadu_si128(reinterpret_cast<__m128i const*>(pb)));
+}
+#endif
+
+}  // namespace detail
+
+/// @brief return the offset of the first differing byte for `a` and `b`
+/// within `n` bytes, or `n` if the byte sequences are equal
+inline std::size_t mismatch(void const* a, void const* b, std::size_t n) noexcept {
+  auto const* const pa = static_cast<unsigned char const*>(a);
+  auto const* const pb = static_cast<unsigned char const*>(b);
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  if (n >= 32) {
+    for (; i + 64 <= n; i += 64) {
+      __m256i const d = _mm256_or_si256(detail::diff32(pa + i, pb + i),
+                                        detail::diff32(pa + i + 32, pb + i + 32));
+      if (!_mm256_testz_si256(d, d)) {
+        break;
+      }
+    }
+    for (; i + 32 <= n; i += 32) {
+      std::uint32_t const eq = detail::eq_mask32(pa + i, pb + i);
+      if (eq != 0xFFFFFFFFu) {
+        return i + std::countr_one(eq);
+      }
+    }
+    if (i < n) {
+      // final overlapping block. Any bytes before `i` are equal
+      std::size_t const st = n - 32;
+      std::uint32_t const eq = detail::eq_mask32(pa + st, pb + st);
+      return (eq != 0xFFFFFFFFu) ? st + std::countr_one(eq) : n;
+    }
+    return n;
+  }
+#endif
+#if PROTOWIRE_SIMD_SSE2
+  if (n >= 16) {
+    __m128i const zero = _mm_setzero_si128();
+    for (; i + 64 <= n; i += 64) {
+      __m128i const d = _mm_or_si128(
+            _mm_or_si128(detail::diff16(pa + i, pb + i),
+                         detail::diff16(pa + i + 16, pb + i + 16)),
+            _mm_or_si128(detail::diff16(pa + i + 32, pb + i + 32),
+                         detail::diff16(pa + i + 48, pb + i + 48)));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(d, zero)) != 0xFFFF) {
+        break;
+      }
+    }
+    for (; i + 16 <= n; i += 16) {
+      std::uint32_t const eq = detail::eq_mask16(pa + i, pb + i);
+      if (eq != 0xFFFFu) {
+        return i + std::countr_one(eq);
+      }
+    }
+    if (i < n) {
+      std::size_t const st = n - 16;
+      std::uint32_t const eq = detail::eq_mask16(pa + st, pb + st);
+      return (eq != 0xFFFFu) ? st + std::countr_one(eq) : n;
+    }
+    return n;
+  }
+#endif
+  for (; i + 8 <= n; i += 8) {
+    std::uint64_t const d =
+          detail::load<std::uint64_t>(pa + i) ^ detail::load<std::uint64_t>(pb + i);
+    if (d != 0) {
+      if constexpr (std::endian::native == std::endian::little) {
+        return i + (std::countr_zero(d) / 8);
+      } else {
+        return i + (std::countl_zero(d) / 8);
+      }
+    }
+  }
+  for (; i < n; ++i) {
+    if (pa[i] != pb[i]) {
+      return i;
+    }
+  }
+  return n;
+}
+
+/// @brief return true if the first `n` bytes of `a` and `b` are equal
+inline bool equal(void const* a, void const* b, std::size_t n) noexcept {
+  auto const* const pa = static_cast<unsigned char const*>(a);
+  auto const* const pb = static_cast<unsigned char const*>(b);
+#if PROTOWIRE_SIMD_AVX2
+  if (n >= 32) {
+    std::size_t i = 0;
+    for (; i + 128 <= n; i += 128) {
+      __m256i const d = _mm256_or_si256(
+            _mm256_or_si256(detail::diff32(pa + i, pb + i),
+                            detail::diff32(pa + i + 32, pb + i + 32)),
+            _mm256_or_si256(detail::diff32(pa + i + 64, pb + i + 64),
+                            detail::diff32(pa + i + 96, pb + i + 96)));
+      if (!_mm256_testz_si256(d, d)) {
+        return false;
+      }
+    }
+    for (; i + 32 <= n; i += 32) {
+      __m256i const d = detail::diff32(pa + i, pb + i);
+      if (!_mm256_testz_si256(d, d)) {
+        return false;
+      }
+    }
+    __m256i const d = detail::diff32(pa + n - 32, pb + n - 32);
+    return _mm256_testz_si256(d, d);
+  }
+#endif
+#if PROTOWIRE_SIMD_SSE2
+  if (n >= 16) {
+    __m128i const zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+      __m128i const d = _mm_or_si128(
+            _mm_or_si128(detail::diff16(pa + i, pb + i),
+                         detail::diff16(pa + i + 16, pb + i + 16)),
+            _mm_or_si128(detail::diff16(pa + i + 32, pb + i + 32),
+                         detail::diff16(pa + i + 48, pb + i + 48)));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(d, zero)) != 0xFFFF) {
+        return false;
+      }
+    }
+    for (; i + 16 <= n; i += 16) {
+      if (detail::eq_mask16(pa + i, pb + i) != 0xFFFFu) {
+        return false;
+      }
+    }
+    return detail::eq_mask16(pa + n - 16, pb + n - 16) == 0xFFFFu;
+  }
+#endif
+  // short sequences, as overlapping word loads
+  if (n >= 8) {
+    std::uint64_t d = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      d |= detail::load<std::uint64_t>(pa + i) ^ detail::load<std::uint64_t>(pb + i);
+    }
+    d |= detail::load<std::uint64_t>(pa + n - 8)
+         ^ detail::load<std::uint64_t>(pb + n - 8);
+    return d == 0;
+  }
+  if (n >= 4) {
+    return ((detail::load<std::uint32_t>(pa) ^ detail::load<std::uint32_t>(pb))
+            | (detail::load<std::uint32_t>(pa + n - 4)
+               ^ detail::load<std::uint32_t>(pb + n - 4)))
+           == 0;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (pa[i] != pb[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief value returned by `find()`, where the needle is not found
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+/// @brief return the offset of the first occurrence of the `m` bytes at
+/// `needle` within the `n` bytes at `haystack`, or `npos` if not found
+///
+/// Candidate offsets are selected by comparing the first and last bytes of
+/// the needle for each offset in a block, then verified with `equal()`.
+/// For an empty needle, returns 0.
+inline std::size_t find(void const* haystack, std::size_t n, void const* needle,
+                        std::size_t m) noexcept {
+  auto const* const ph = static_cast<unsigned char const*>(haystack);
+  auto const* const pn = static_cast<unsigned char const*>(needle);
+  if (m == 0) {
+    return 0;
+  }
+  if (m > n) {
+    return npos;
+  }
+  if (m == 1) {
+    auto const* const p = static_cast<unsigned char const*>(std::memchr(ph, pn[0], n));
+    return (p != nullptr) ? static_cast<std::size_t>(p - ph) : npos;
+  }
+  // each offset `i` with `i + m <= n`
+  std::size_t const end = n - m + 1;
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  __m256i const first32 = _mm256_set1_epi8(static_cast<char>(pn[0]));
+  __m256i const last32 = _mm256_set1_epi8(static_cast<char>(pn[m - 1]));
+  for (; i + 32 <= end; i += 32) {
+    __m256i const bf = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ph + i));
+    __m256i const bl =
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ph + i + m - 1));
+    auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+          _mm256_cmpeq_epi8(bf, first32), _mm256_cmpeq_epi8(bl, last32))));
+    for (; mask != 0; mask &= mask - 1) {
+      std::size_t const pos = i + std::countr_zero(mask);
+      if (equal(ph + pos + 1, pn + 1, m - 2)) {
+        return pos;
+      }
+    }
+  }
+#endif
+#if PROTOWIRE_SIMD_SSE2
+  __m128i const first16 = _mm_set1_epi8(static_cast<char>(pn[0]));
+  __m128i const last16 = _mm_set1_epi8(static_cast<char>(pn[m - 1]));
+  for (; i + 16 <= end; i += 16) {
+    __m128i const bf = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ph + i));
+    __m128i const bl = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ph + i + m - 1));
+    auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+          _mm_and_si128(_mm_cmpeq_epi8(bf, first16), _mm_cmpeq_epi8(bl, last16))));
+    for (; mask != 0; mask &= mask - 1) {
+      std::size_t const pos = i + std::countr_zero(mask);
+      if (equal(ph + pos + 1, pn + 1, m - 2)) {
+        return pos;
+      }
+    }
+  }
+#endif
+  // remaining offsets, with `memchr()` for the first byte
+  while (i < end) {
+    auto const* const p =
+          static_cast<unsigned char const*>(std::memchr(ph + i, pn[0], end - i));
+    if (p == nullptr) {
+      return npos;
+    }
+    auto const pos = static_cast<std::size_t>(p - ph);
+    if (ph[pos + m - 1] == pn[m - 1] && equal(ph + pos + 1, pn + 1, m - 2)) {
+      return pos;
+    }
+    i = pos + 1;
+  }
+  return npos;
+}
+
+/// @brief return the length of the leading run of printable ASCII bytes,
+/// other than `delim` or a backslash, within the `n` bytes at `p`
+///
+/// This is the run of bytes that can be written without escaping, for
+/// text quoted with `delim`
+inline std::size_t plain_prefix(void const* p, std::size_t n, char delim) noexcept {
+  auto const* const pc = static_cast<unsigned char const*>(p);
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  if (n >= 32) {
+    // signed comparison, such that bytes from 0x80 are also less than 0x20
+    __m256i const space = _mm256_set1_epi8(0x20);
+    __m256i const del = _mm256_set1_epi8(0x7F);
+    __m256i const dv = _mm256_set1_epi8(delim);
+    __m256i const bs = _mm256_set1_epi8('\\');
+    for (; i + 32 <= n; i += 32) {
+      __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pc + i));
+      __m256i const special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpgt_epi8(space, v), _mm256_cmpeq_epi8(v, del)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, dv), _mm256_cmpeq_epi8(v, bs)));
+      if (auto const m = static_cast<std::uint32_t>(_mm256_movemask_epi8(special))) {
+        return i + std::countr_zero(m);
+      }
+    }
+  }
+#endif
+#if PROTOWIRE_SIMD_SSE2
+  if (n - i >= 16) {
+    __m128i const space = _mm_set1_epi8(0x20);
+    __m128i const del = _mm_set1_epi8(0x7F);
+    __m128i const dv = _mm_set1_epi8(delim);
+    __m128i const bs = _mm_set1_epi8('\\');
+    for (; i + 16 <= n; i += 16) {
+      __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pc + i));
+      __m128i const special =
+            _mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del)),
+                         _mm_or_si128(_mm_cmpeq_epi8(v, dv), _mm_cmpeq_epi8(v, bs)));
+      if (auto const m = static_cast<std::uint32_t>(_mm_movemask_epi8(special))) {
+        return i + std::countr_zero(m);
+      }
+    }
+  }
+#endif
+  auto const d = static_cast<unsigned char>(delim);
+  for (; i < n; ++i) {
+    unsigned char const c = pc[i];
+    if (c < 0x20 || c >= 0x7F || c == d || c == '\\') {
+      return i;
+    }
+  }
+  return n;
+}
+
+namespace detail {
+
+/// @brief lowercase hex digits for each byte value, as pairs
+inline constexpr auto hex_pairs = []() {
+  constexpr char digits[] = "0123456789abcdef";
+  std::array<char, 512> table{};
+  for (std::size_t b = 0; b < 256; ++b) {
+    table[b * 2] = digits[b >> 4];
+    table[b * 2 + 1] = digits[b & 0xF];
+  }
+  return table;
+}();
+
+}  // namespace detail
+
+/// @brief write two lowercase hex digits for each of the `n` bytes at `p`,
+/// to the `2 * n` characters at `out`
+inline void hex_encode(void const* p, std::size_t n, char* out) noexcept {
+  auto const* const pc = static_cast<unsigned char const*>(p);
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_SSE2
+  if (n >= 16) {
+    __m128i const nibble = _mm_set1_epi8(0x0F);
+    __m128i const nine = _mm_set1_epi8(9);
+    __m128i const zero = _mm_set1_epi8('0');
+    __m128i const alpha = _mm_set1_epi8('a' - '0' - 10);
+    // the ASCII digit for each nibble value
+    auto const digits = [&](__m128i x) {
+      return _mm_add_epi8(_mm_add_epi8(x, zero),
+                          _mm_and_si128(_mm_cmpgt_epi8(x, nine), alpha));
+    };
+    for (; i + 16 <= n; i += 16) {
+      __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pc + i));
+      __m128i const hi = digits(_mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+      __m128i const lo = digits(_mm_and_si128(v, nibble));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2),
+                       _mm_unpacklo_epi8(hi, lo));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 16),
+                       _mm_unpackhi_epi8(hi, lo));
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    std::memcpy(out + i * 2, detail::hex_pairs.data() + pc[i] * 2, 2);
+  }
+}
+
+}  // namespace simd
+}  // namespace util
+}  // namespace protowire
@@ -2,7 +2,7 @@
  * @file type_name.hpp
  * @author Sean Champ <spchamp@users.noreply.github.com>
  * @brief utilities for user-visible type names
- * @version 0.2
+ * @version 0.3
  * @date 2025-11-28
  *
  * @copyright Copyright (c) 2025 Sean Champ
@@ -25,15 +25,216 @@
 
 #pragma once
 
+#include <array>
 #include <concepts>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <type_traits>
+
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+#define PROTOWIRE_TYPE_NAME_RTTI 1
+#include <typeinfo>
+#if !defined(PROTOWIRE_UTIL_LIBRARY)
 #include <boost/core/demangle.hpp>
+#endif
+#else
+#define PROTOWIRE_TYPE_NAME_RTTI 0
+#endif
 
 namespace protowire {
 namespace util {
 namespace type_name {
 
+namespace detail {
+
+/// @brief compiler-specific function signature, including the name of `T`
+template <typename T>
+constexpr std::string_view raw_signature() noexcept {
+#if defined(PROTOWIRE_TYPE_NAME_NO_CONSTEXPR)
+  return {};
+#elif defined(__clang__) || defined(__GNUC__)
+  return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+  return __FUNCSIG__;
+#else
+  return {};
+#endif
+}
+
+/// @brief layout of `raw_signature<T>()` for the active compiler
+///
+/// The prefix and suffix lengths are measured from the signature for a
+/// probe type with a known spelling. The signature format is assumed
+/// to be otherwise independent of `T`.
+struct signature_format {
+  static constexpr std::string_view probe_name = "double";
+  static constexpr std::string_view probe = raw_signature<double>();
+  static constexpr std::size_t prefix = probe.find(probe_name);
+  static constexpr bool supported = (prefix != std::string_view::npos);
+  static constexpr std::size_t suffix =
+        supported ? probe.size() - prefix - probe_name.size() : 0;
+};
+
+/// @brief name of `T` as extracted from the compiler signature,
+/// or an empty string if the signature format is not supported
+template <typename T>
+constexpr std::string_view pretty_name() noexcept {
+  if constexpr (signature_format::supported) {
+    constexpr std::string_view sig = raw_signature<T>();
+    std::string_view name = sig.substr(
+          signature_format::prefix,
+          sig.size() - signature_format::prefix - signature_format::suffix);
+#if defined(_MSC_VER) && !defined(__clang__)
+    for (std::string_view const tag : {"class ", "struct ", "enum ", "union "}) {
+      if (name.starts_with(tag)) {
+        name.remove_prefix(tag.size());
+        break;
+      }
+    }
+#endif
+    return name;
+  } else {
+    return {};
+  }
+}
+
+/// @brief null-terminated, statically allocated concatenation of `Parts`
+template <std::string_view const&... Parts>
+struct static_join {
+  static constexpr std::size_t size = (Parts.size() + ... + 0);
+
+  static constexpr std::array<char, size + 1> make() noexcept {
+    std::array<char, size + 1> arr{};
+    std::size_t n = 0;
+    ((n = Parts.copy(arr.data() + n, Parts.size()) + n), ...);
+    return arr;
+  }
+
+  static constexpr std::array<char, size + 1> data = make();
+  static constexpr std::string_view value{data.data(), size};
+};
+
+/// @brief true if a type-id may begin at offset `i` of `name`, i.e at the
+/// start of the name, of a template argument or of a function parameter
+constexpr bool type_id_start(std::string_view name, std::size_t i) noexcept {
+  return i == 0 || name[i - 1] == '<' || name[i - 1] == '('
+         || (i >= 2 && name[i - 1] == ' ' && name[i - 2] == ',');
+}
+
+/// @brief length of the leading cv-qualifiers in `name`, e.g 15 for
+/// `const volatile int`
+constexpr std::size_t cv_prefix_size(std::string_view name) noexcept {
+  std::size_t n = 0;
+  for (;;) {
+    if (name.substr(n).starts_with("const ")) {
+      n += 6;
+    } else if (name.substr(n).starts_with("volatile ")) {
+      n += 9;
+    } else {
+      return n;
+    }
+  }
+}
+
+/// @brief end of the type specifier at the start of `name`, before any
+/// pointer, reference, array or function declarator, or the end of the
+/// template argument
+constexpr std::size_t type_specifier_end(std::string_view name) noexcept {
+  int depth = 0;
+  std::size_t i = 0;
+  for (; i < name.size(); ++i) {
+    char const c = name[i];
+    if (c == '<' || (c == '(' && (i == 0 || name[i - 1] == ':'))) {
+      // template arguments, or e.g `(anonymous namespace)::`
+      ++depth;
+    } else if (depth > 0) {
+      depth -= (c == '>' || c == ')') ? 1 : 0;
+    } else if (std::string_view{"*&,>)(["}.find(c) != std::string_view::npos) {
+      break;
+    }
+  }
+  return (i > 0 && name[i - 1] == ' ') ? i - 1 : i;
+}
+
+/// @brief write `name` to `out`, with each leading cv-qualifier of a type
+/// moved after the type specifier, e.g `std::optional<int const>` for
+/// `std::optional<const int>`, as in demangled names
+///
+/// @return the number of characters written, at most the size of `name`
+constexpr std::size_t east_const(std::string_view name, char* out) noexcept {
+  std::size_t n = 0;
+  std::size_t i = 0;
+  while (i < name.size()) {
+    std::size_t const cv = type_id_start(name, i) ? cv_prefix_size(name.substr(i)) : 0;
+    if (cv == 0) {
+      out[n++] = name[i++];
+      continue;
+    }
+    std::string_view const rest = name.substr(i + cv);
+    std::size_t const end = type_specifier_end(rest);
+    n += east_const(rest.substr(0, end), out + n);
+    out[n++] = ' ';
+    n += name.substr(i, cv - 1).copy(out + n, cv - 1);
+    i += cv + end;
+    if (name.substr(i).starts_with(" >")) {
+      // e.g `std::optional<T> const>`, for `const std::optional<T> >`
+      ++i;
+    }
+  }
+  return n;
+}
+
+template <std::string_view const& Name>
+struct east_const_name {
+  static constexpr std::array<char, Name.size() + 1> make() noexcept {
+    std::array<char, Name.size() + 1> arr{};
+    east_const(Name, arr.data());
+    return arr;
+  }
+
+  static constexpr std::size_t size() noexcept {
+    std::array<char, Name.size() + 1> arr{};
+    return east_const(Name, arr.data());
+  }
+
+  static constexpr std::array<char, Name.size() + 1> data = make();
+  static constexpr std::string_view value{data.data(), size()};
+};
+
+template <typename T>
+struct pretty_name_storage {
+  static constexpr std::string_view raw = pretty_name<T>();
+  static constexpr std::string_view value = east_const_name<raw>::value;
+};
+
+#if PROTOWIRE_TYPE_NAME_RTTI && defined(PROTOWIRE_UTIL_LIBRARY)
+/// @brief return the demangled form of the type name `mangled`, as with
+/// `boost::core::demangle()`. Defined in the protowire_util library
+std::string demangle(char const* mangled);
+#endif
+
+template <typename T>
+std::string runtime_name() {
+#if PROTOWIRE_TYPE_NAME_RTTI && defined(PROTOWIRE_UTIL_LIBRARY)
+  return demangle(typeid(T).name());
+#elif PROTOWIRE_TYPE_NAME_RTTI
+  return boost::core::demangle(typeid(T).name());
+#else
+  return "{unknown type}";
+#endif
+}
+
+inline constexpr std::string_view const_suffix = " const";
+inline constexpr std::string_view pointer_suffix = "*";
+inline constexpr std::string_view lvalue_suffix = "&";
+inline constexpr std::string_view rvalue_suffix = "&&";
+
+}  // namespace detail
+
+/// @brief true if `type_name<T>::value` is available as a constant expression
+inline constexpr bool constexpr_names = detail::signature_format::supported;
+
 /// @brief utility type for producing a string representing
 /// a demangled type name for `T`
 ///
@@ -45,41 +246,84 @@ namespace type_name {
 /// std::cout << type_name<std::optional<int>>::apply();
 /// ```
 ///
-/// This implementation uses `boost::core::demagle`
+/// Where `constexpr_names` is true, `value` is a compile-time name
+/// for `T`, derived from the compiler's function signature for a
+/// template function. This does not require RTTI. Nested cv-qualifiers
+/// are written in east `const` syntax, e.g `std::optional<int const>`,
+/// as in demangled names. Default template arguments may be omitted,
+/// and builtin types may be spelled differently than when demangled,
+/// depending on the compiler.
+///
+/// Otherwise, `view()` and `apply()` will use `boost::core::demangle`
+/// for the name of `T`, if RTTI is enabled.
 ///
 template <typename T>
 struct type_name {
-  static std::string const apply() noexcept {
-    return boost::core::demangle(typeid(T).name());
+  static constexpr std::string_view value = detail::pretty_name_storage<T>::value;
+
+  /// @brief return a statically allocated name for `T`
+  static std::string_view view() noexcept {
+    if constexpr (constexpr_names) {
+      return value;
+    } else {
+      static std::string const name = detail::runtime_name<T>();
+      return name;
+    }
   }
+
+  static std::string const apply() noexcept { return std::string{view()}; }
+};
+
+/// @brief common implementation for type names as a suffixed name
+/// @tparam Base type name for the unqualified type
+/// @tparam Suffix literal suffix
+template <typename Base, std::string_view const& Suffix>
+struct suffixed_type_name {
+  static constexpr std::string_view value =
+        detail::static_join<Base::value, Suffix>::value;
+
+  static std::string_view view() noexcept {
+    if constexpr (constexpr_names) {
+      return value;
+    } else {
+      static std::string const name = std::string{Base::view()}.append(Suffix);
+      return name;
+    }
+  }
+
+  static std::string const apply() noexcept { return std::string{view()}; }
 };
 
 /// @brief `type_name` with east `const` syntax
 /// @tparam T type
 template <typename T>
   requires (std::is_const_v<T>)
-struct type_name<T> {
-  static std::string const apply() noexcept {
-    return type_name<std::remove_cv_t<T>>::apply() + " const";
-  }
-};
+struct type_name<T>
+    : suffixed_type_name<type_name<std::remove_cv_t<T>>, detail::const_suffix> {};
 
 template <typename T>
   requires (std::is_lvalue_reference_v<T>)
-struct type_name<T> {
-  static std::string const apply() noexcept {
-    return type_name<std::remove_reference_t<T>>::apply() + "&";
-  }
+struct type_name<T>
+    : suffixed_type_name<type_name<std::remove_reference_t<T>>, detail::lvalue_suffix> {
 };
 
 template <typename T>
   requires (std::is_rvalue_reference_v<T>)
-struct type_name<T> {
-  static std::string const apply() noexcept {
-    return type_name<std::remove_reference_t<T>>::apply() + "&&";
-  }
+struct type_name<T>
+    : suffixed_type_name<type_name<std::remove_reference_t<T>>, detail::rvalue_suffix> {
 };
 
+/// @brief `type_name` for object pointers, with east `const` syntax
+/// for the pointed-to type
+template <typename T>
+  requires (!std::is_function_v<T>)
+struct type_name<T*> : suffixed_type_name<type_name<T>, detail::pointer_suffix> {};
+
+/// @brief shorthand for `type_name<T>::value`
+template <typename T>
+  requires (constexpr_names)
+inline constexpr std::string_view type_name_v = type_name<T>::value;
+
 }  // namespace type_name
 }  // namespace util
 }  // namespace protowire
@@ -0,0 +1,282 @@
+/**
+ * @file utf.hpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief validating UTF-8, UTF-16 and UTF-32 transcoding to UTF-8
+ * @version 0.1
+ * @date 2026-02-02
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include <protowire/util/simd.hpp>
+
+namespace protowire {
+namespace util {
+namespace utf {
+
+/// @brief a character type for UTF-8, UTF-16 or UTF-32 text. The encoding
+/// is selected by the size of the type, e.g UTF-32 for a four-byte `wchar_t`
+template <typename CharT>
+concept utf_char = std::is_integral_v<CharT>
+                   && (sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4);
+
+/// @brief value returned by `decode()`, for an invalid sequence
+inline constexpr char32_t invalid_code_point = 0x110000;
+
+inline constexpr char32_t replacement_character = 0xFFFD;
+
+/// @brief UTF-8 encoding of the replacement character
+inline constexpr std::string_view replacement_utf8{"\xEF\xBF\xBD"};
+
+/// @brief return the number of leading ASCII code units in the `n` code
+/// units at `p`
+template <utf_char CharT>
+std::size_t ascii_prefix(CharT const* p, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_AVX2
+  if constexpr (sizeof(CharT) == 1) {
+    for (; i + 32 <= n; i += 32) {
+      __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + i));
+      if (std::uint32_t const m = static_cast<std::uint32_t>(_mm256_movemask_epi8(v))) {
+        return i + std::countr_zero(m);
+      }
+    }
+  }
+#endif
+#if PROTOWIRE_SIMD_SSE2
+  constexpr std::size_t lanes = 16 / sizeof(CharT);
+  // the bits of a code unit that are zero for ASCII
+  __m128i const high = (sizeof(CharT) == 1) ? _mm_set1_epi8(static_cast<char>(0x80))
+                       : (sizeof(CharT) == 2)
+                             ? _mm_set1_epi16(static_cast<short>(0xFF80))
+                             : _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+  for (; i + lanes <= n; i += lanes) {
+    __m128i const v =
+          _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), high);
+    // one bit for each byte, set for each byte of a non-ASCII code unit
+    auto const m = static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) ^ 0xFFFF);
+    if (m != 0) {
+      return i + std::countr_zero(m) / sizeof(CharT);
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if (static_cast<std::make_unsigned_t<CharT>>(p[i]) >= 0x80) {
+      return i;
+    }
+  }
+  return n;
+}
+
+/// @brief copy the leading ASCII code units of the `n` code units at `p`
+/// to `out`, as `char`
+///
+/// @return the number of code units copied
+template <utf_char CharT>
+std::size_t narrow_ascii(CharT const* p, std::size_t n, char* out) noexcept {
+  std::size_t const k = ascii_prefix(p, n);
+  std::size_t i = 0;
+#if PROTOWIRE_SIMD_SSE2
+  // values are ASCII, such that the saturating packs are exact
+  if constexpr (sizeof(CharT) == 2) {
+    for (; i + 16 <= k; i += 16) {
+      __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+      __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i + 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+    }
+  } else if constexpr (sizeof(CharT) == 4) {
+    for (; i + 16 <= k; i += 16) {
+      auto const* const q = reinterpret_cast<__m128i const*>(p + i);
+      __m128i const a = _mm_packs_epi32(_mm_loadu_si128(q), _mm_loadu_si128(q + 1));
+      __m128i const b = _mm_packs_epi32(_mm_loadu_si128(q + 2), _mm_loadu_si128(q + 3));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+    }
+  }
+#endif
+  for (; i < k; ++i) {
+    out[i] = static_cast<char>(p[i]);
+  }
+  return k;
+}
+
+/// @brief decode one code point from `p`, for `p != e`, advancing `p`
+///
+/// For an invalid sequence, returns `invalid_code_point`, advancing `p` past
+/// the maximal subpart of the sequence, as recommended in the Unicode
+/// standard for the use of replacement characters
+template <utf_char CharT>
+char32_t decode(CharT const*& p, CharT const* const e) noexcept {
+  if constexpr (sizeof(CharT) == 1) {
+    auto const b0 = static_cast<unsigned char>(*p++);
+    if (b0 < 0x80) {
+      return b0;
+    }
+    std::size_t need = 0;
+    char32_t c = 0;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    if (b0 >= 0xC2 && b0 <= 0xDF) {
+      need = 1;
+      c = b0 & 0x1F;
+    } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+      need = 2;
+      c = b0 & 0x0F;
+      lo = (b0 == 0xE0) ? 0xA0 : 0x80;
+      hi = (b0 == 0xED) ? 0x9F : 0xBF;
+    } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+      need = 3;
+      c = b0 & 0x07;
+      lo = (b0 == 0xF0) ? 0x90 : 0x80;
+      hi = (b0 == 0xF4) ? 0x8F : 0xBF;
+    } else {
+      return invalid_code_point;
+    }
+    for (; need != 0; --need) {
+      if (p == e) {
+        return invalid_code_point;
+      }
+      auto const b = static_cast<unsigned char>(*p);
+      if (b < lo || b > hi) {
+        return invalid_code_point;
+      }
+      c = (c << 6) | (b & 0x3F);
+      lo = 0x80;
+      hi = 0xBF;
+      ++p;
+    }
+    return c;
+  } else if constexpr (sizeof(CharT) == 2) {
+    auto const u = static_cast<char16_t>(*p++);
+    if (u < 0xD800 || u > 0xDFFF) {
+      return u;
+    }
+    if (u > 0xDBFF || p == e) {
+      return invalid_code_point;
+    }
+    auto const l = static_cast<char16_t>(*p);
+    if (l < 0xDC00 || l > 0xDFFF) {
+      return invalid_code_point;
+    }
+    ++p;
+    return 0x10000 + ((static_cast<char32_t>(u) - 0xD800) << 10) + (l - 0xDC00);
+  } else {
+    auto const c = static_cast<char32_t>(*p++);
+    return (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) ? invalid_code_point : c;
+  }
+}
+
+/// @brief write the UTF-8 encoding of the code point `c` to `out`, with
+/// space for at least four characters
+///
+/// @return the number of characters written
+inline std::size_t encode_utf8(char32_t c, char* out) noexcept {
+  if (c < 0x80) {
+    out[0] = static_cast<char>(c);
+    return 1;
+  }
+  if (c < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (c >> 6));
+    out[1] = static_cast<char>(0x80 | (c & 0x3F));
+    return 2;
+  }
+  if (c < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (c >> 12));
+    out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (c & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (c >> 18));
+  out[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (c & 0x3F));
+  return 4;
+}
+
+/// @brief size of the buffer used in `to_utf8()`, for UTF-16 and UTF-32
+inline constexpr std::size_t transcode_buffer_size = 256;
+
+/// @brief transcode the `n` code units at `p` to UTF-8, calling `sink(s)`
+/// for each segment `s` of the result
+///
+/// Invalid sequences are written as the replacement character. For UTF-8
+/// input, each valid span of the input is passed to the sink without
+/// copying. Otherwise, segments are transcoded into a local buffer, with
+/// ASCII text narrowed in blocks. This does not allocate.
+template <utf_char CharT, typename Sink>
+void to_utf8(CharT const* p, std::size_t n, Sink&& sink) {
+  CharT const* const e = p + n;
+  if constexpr (sizeof(CharT) == 1) {
+    CharT const* valid = p;
+    while (p != e) {
+      p += ascii_prefix(p, static_cast<std::size_t>(e - p));
+      if (p == e) {
+        break;
+      }
+      CharT const* const start = p;
+      if (decode(p, e) == invalid_code_point) {
+        if (start != valid) {
+          sink(std::string_view{reinterpret_cast<char const*>(valid),
+                                static_cast<std::size_t>(start - valid)});
+        }
+        sink(replacement_utf8);
+        valid = p;
+      }
+    }
+    if (valid != e) {
+      sink(std::string_view{reinterpret_cast<char const*>(valid),
+                            static_cast<std::size_t>(e - valid)});
+    }
+  } else {
+    char buf[transcode_buffer_size];
+    std::size_t len = 0;
+    while (p != e) {
+      if (transcode_buffer_size - len < 4) {
+        sink(std::string_view{buf, len});
+        len = 0;
+      }
+      std::size_t const k = narrow_ascii(
+            p, std::min<std::size_t>(static_cast<std::size_t>(e - p),
+                                     transcode_buffer_size - len),
+            buf + len);
+      len += k;
+      p += k;
+      if (p != e && static_cast<std::make_unsigned_t<CharT>>(*p) >= 0x80
+          && transcode_buffer_size - len >= 4) {
+        char32_t const c = decode(p, e);
+        len += encode_utf8((c == invalid_code_point) ? replacement_character : c,
+                           buf + len);
+      }
+    }
+    if (len != 0) {
+      sink(std::string_view{buf, len});
+    }
+  }
+}
+
+}  // namespace utf
+}  // namespace util
+}  // namespace protowire
@@ -0,0 +1,60 @@
+/**
+ * @file protowire.metatypes.cppm
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief module interface for the headers in protowire/metatypes
+ * @version 0.1
+ * @date 2026-02-10
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+// The `indeterminate_value`, `true_value` and `false_value` constants in
+// tribool_p.hpp have internal linkage, and are not exported. The
+// `indeterminate_`, `true_` and `false_` types provide the same values.
+
+module;
+
+#include <protowire/metatypes/tribool.hpp>
+#include <protowire/metatypes/tribool_p.hpp>
+#include <protowire/metatypes/tribool_vector.hpp>
+
+export module protowire.metatypes;
+
+export namespace protowire::metatypes {
+
+using protowire::metatypes::false_;
+using protowire::metatypes::false_type;
+using protowire::metatypes::if_indeterminate;
+using protowire::metatypes::if_indeterminate_c;
+using protowire::metatypes::indeterminate;
+using protowire::metatypes::indeterminate_;
+using protowire::metatypes::indeterminate_keyword_t;
+using protowire::metatypes::indeterminate_type;
+using protowire::metatypes::tribool;
+using protowire::metatypes::tribool_;
+using protowire::metatypes::tribool_all_known;
+using protowire::metatypes::tribool_and;
+using protowire::metatypes::tribool_constant;
+using protowire::metatypes::tribool_like;
+using protowire::metatypes::tribool_not;
+using protowire::metatypes::tribool_or;
+using protowire::metatypes::tribool_tag;
+using protowire::metatypes::tribool_vector;
+using protowire::metatypes::true_;
+using protowire::metatypes::true_type;
+
+}  // namespace protowire::metatypes
@@ -0,0 +1,95 @@
+/**
+ * @file protowire.test.cppm
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief module interface for the object and type representations in protowire/test
+ * @version 0.1
+ * @date 2026-02-10
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+// The Catch2 integration in check_str.hpp, lazy_capture.hpp and
+// typecatch.hpp is provided as macros, which cannot be exported from a
+// module. Include those headers directly, with or without importing this
+// module. The std::formatter and fmt::formatter specializations from
+// repr_format.hpp are available with the module.
+
+module;
+
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/repr_arena.hpp>
+#include <protowire/test/repr_format.hpp>
+#include <protowire/test/type_repr.hpp>
+
+export module protowire.test;
+
+export import protowire.util;
+
+export namespace protowire::test {
+
+namespace type_repr {
+using protowire::test::type_repr::infix_repr;
+using protowire::test::type_repr::memoized_repr;
+using protowire::test::type_repr::meta_prefix;
+using protowire::test::type_repr::prefix_repr;
+using protowire::test::type_repr::suffix_repr;
+using protowire::test::type_repr::template_repr;
+using protowire::test::type_repr::type_repr;
+using protowire::test::type_repr::with_repr_stream;
+}  // namespace type_repr
+
+namespace object_repr {
+using protowire::test::object_repr::byte_format;
+using protowire::test::object_repr::bytes_repr;
+using protowire::test::object_repr::char_nc_ptr_repr;
+using protowire::test::object_repr::char_ptr_repr;
+using protowire::test::object_repr::char_repr;
+using protowire::test::object_repr::const_name_repr;
+using protowire::test::object_repr::current_repr_limits;
+using protowire::test::object_repr::formattable_repr;
+using protowire::test::object_repr::inline_repr;
+using protowire::test::object_repr::object_repr;
+using protowire::test::object_repr::quote_mode;
+using protowire::test::object_repr::range_repr;
+using protowire::test::object_repr::repr_arena;
+using protowire::test::object_repr::repr_bytes;
+using protowire::test::object_repr::repr_format_to;
+using protowire::test::object_repr::repr_inline;
+using protowire::test::object_repr::repr_interface;
+using protowire::test::object_repr::repr_limits;
+using protowire::test::object_repr::repr_map;
+using protowire::test::object_repr::repr_range;
+using protowire::test::object_repr::repr_scratch;
+using protowire::test::object_repr::repr_string;
+using protowire::test::object_repr::repr_string_to;
+using protowire::test::object_repr::repr_write;
+using protowire::test::object_repr::scoped_repr_limits;
+using protowire::test::object_repr::scratch_retain_size;
+using protowire::test::object_repr::string_prefix;
+using protowire::test::object_repr::text_format_to;
+using protowire::test::object_repr::text_repr;
+using protowire::test::object_repr::tuple_repr;
+using protowire::test::object_repr::with_repr_view;
+}  // namespace object_repr
+
+namespace repr_format {
+using protowire::test::repr_format::repr;
+using protowire::test::repr_format::repr_type;
+using protowire::test::repr_format::with_repr_view;
+}  // namespace repr_format
+
+}  // namespace protowire::test
@@ -0,0 +1,106 @@
+/**
+ * @file protowire.util.cppm
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief module interface for the headers in protowire/util
+ * @version 0.1
+ * @date 2026-02-10
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+// The headers are included in the global module fragment, and each public
+// name is exported with a using-declaration. Macros, e.g for SIMD
+// configuration, are not exported; include the header for those.
+
+module;
+
+#include <protowire/util/base64.hpp>
+#include <protowire/util/intern.hpp>
+#include <protowire/util/lstring.hpp>
+#include <protowire/util/lstring_map.hpp>
+#include <protowire/util/simd.hpp>
+#include <protowire/util/type_name.hpp>
+#include <protowire/util/utf.hpp>
+
+export module protowire.util;
+
+export namespace protowire::util {
+
+namespace base64 {
+using protowire::util::base64::alphabet;
+using protowire::util::base64::encode;
+using protowire::util::base64::encoded_size;
+}  // namespace base64
+
+namespace intern {
+using protowire::util::intern::global_pool;
+using protowire::util::intern::intern;
+using protowire::util::intern::intern_pool;
+using protowire::util::intern::intern_seed;
+using protowire::util::intern::intern_stats;
+using protowire::util::intern::interned;
+using protowire::util::intern::interned_literal;
+}  // namespace intern
+
+namespace lstring {
+using protowire::util::lstring::basic_lstring_map;
+using protowire::util::lstring::default_hash;
+using protowire::util::lstring::fnv1a_hash;
+using protowire::util::lstring::join;
+using protowire::util::lstring::LBasicString;
+using protowire::util::lstring::lstring_hash_v;
+using protowire::util::lstring::lstring_hasher;
+using protowire::util::lstring::lstring_kv;
+using protowire::util::lstring::lstring_map;
+using protowire::util::lstring::LString;
+using protowire::util::lstring::operator+;
+using protowire::util::lstring::to_lstring;
+using protowire::util::lstring::U8String;
+using protowire::util::lstring::WString;
+using protowire::util::lstring::xxh64_hash;
+}  // namespace lstring
+
+namespace simd {
+using protowire::util::simd::equal;
+using protowire::util::simd::find;
+using protowire::util::simd::hex_encode;
+using protowire::util::simd::mismatch;
+using protowire::util::simd::npos;
+using protowire::util::simd::plain_prefix;
+}  // namespace simd
+
+namespace type_name {
+using protowire::util::type_name::constexpr_names;
+using protowire::util::type_name::suffixed_type_name;
+using protowire::util::type_name::type_name;
+using protowire::util::type_name::type_name_v;
+}  // namespace type_name
+
+namespace utf {
+using protowire::util::utf::ascii_prefix;
+using protowire::util::utf::decode;
+using protowire::util::utf::encode_utf8;
+using protowire::util::utf::invalid_code_point;
+using protowire::util::utf::narrow_ascii;
+using protowire::util::utf::replacement_character;
+using protowire::util::utf::replacement_utf8;
+using protowire::util::utf::to_utf8;
+using protowire::util::utf::transcode_buffer_size;
+using protowire::util::utf::utf_char;
+}  // namespace utf
+
+}  // namespace protowire::util
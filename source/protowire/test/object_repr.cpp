@@ -0,0 +1,45 @@
+/**
+ * @file object_repr.cpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief explicit instantiations of common object_repr specializations
+ * @version 0.1
+ * @date 2026-02-09
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <protowire/test/object_repr.hpp>
+
+namespace protowire {
+namespace test {
+namespace object_repr {
+
+#define PROTOWIRE_OBJECT_REPR_DEFINE(T, ...)                                             \
+  PROTOWIRE_OBJECT_REPR_INSTANTIATE(, T, __VA_ARGS__)
+
+PROTOWIRE_OBJECT_REPR_LIBRARY_TYPES(PROTOWIRE_OBJECT_REPR_DEFINE)
+
+#undef PROTOWIRE_OBJECT_REPR_DEFINE
+
+}  // namespace object_repr
+}  // namespace test
+}  // namespace protowire
@@ -0,0 +1,45 @@
+/**
+ * @file type_name.cpp
+ * @author Sean Champ <spchamp@users.noreply.github.com>
+ * @brief runtime type names, for the protowire_util library
+ * @version 0.1
+ * @date 2026-02-09
+ *
+ * @copyright Copyright (c) 2026 Sean Champ
+ * @par License:
+ *
+ * This file is part of the libprotowire_util software project.
+ * libprotowire_util is free software; you can redistribute it
+ * and/or modify it under the terms of the Artistic License 2.0.
+ *
+ * This package is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the Artistic License 2.0
+ * along with libprotowire_util; if not, see
+ * <https://github.com/protowire-hub/libprotowire_util/blob/main/COPYING.md>
+ *
+ */
+
+#include <protowire/util/type_name.hpp>
+
+#if PROTOWIRE_TYPE_NAME_RTTI
+#include <boost/core/demangle.hpp>
+#endif
+
+namespace protowire {
+namespace util {
+namespace type_name {
+namespace detail {
+
+#if PROTOWIRE_TYPE_NAME_RTTI
+std::string demangle(char const* mangled) {
+  return boost::core::demangle(mangled);
+}
+#endif
+
+}  // namespace detail
+}  // namespace type_name
+}  // namespace util
+}  // namespace protowire
@@ -0,0 +1,118 @@
+// tests for the constexpr tribool type
+
+#include <array>
+#include <type_traits>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool.hpp>
+#include <protowire/metatypes/tribool_p.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace logic = boost::logic;
+
+using protowire::metatypes::if_indeterminate;
+using protowire::metatypes::if_indeterminate_c;
+using protowire::metatypes::indeterminate;
+using protowire::metatypes::tribool;
+
+namespace {
+
+constexpr tribool F{false};
+constexpr tribool I{indeterminate};
+constexpr tribool T{true};
+
+constexpr std::array<tribool, 3> values{F, I, T};
+
+template <tribool V>
+struct nttp {
+  static constexpr tribool value = V;
+};
+
+/// Kleene AND, as a truth table
+constexpr tribool table_and(tribool a, tribool b) {
+  if (a == F || b == F) {
+    return F;
+  }
+  return (a == T && b == T) ? T : I;
+}
+
+/// Kleene OR, as a truth table
+constexpr tribool table_or(tribool a, tribool b) {
+  if (a == T || b == T) {
+    return T;
+  }
+  return (a == F && b == F) ? F : I;
+}
+
+constexpr bool check_tables() {
+  for (tribool const a : values) {
+    for (tribool const b : values) {
+      if ((a && b) != table_and(a, b) || (a || b) != table_or(a, b)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_CASE("tribool: values") {
+  static_assert(sizeof(tribool) == 1);
+  static_assert(std::is_trivially_copyable_v<tribool>);
+  static_assert(tribool{} == F);
+  static_assert(indeterminate(I) && !indeterminate(F) && !indeterminate(T));
+  static_assert(static_cast<bool>(T) && !static_cast<bool>(F) && !static_cast<bool>(I));
+
+  static_assert((!T) == F && (!F) == T && (!I) == I);
+  static_assert(check_tables());
+  static_assert((T && true) == T && (F || false) == F && (I && false) == F);
+  static_assert((true && I) == I && (true || I) == T);
+  CHECK(check_tables());
+}
+
+TEST_CASE("tribool: template parameters") {
+  static_assert(nttp<I>::value == I);
+  static_assert(!std::is_same_v<nttp<T>, nttp<F>>);
+  static_assert(std::is_same_v<nttp<T && I>, nttp<I>>);
+  static_assert(std::is_same_v<nttp<true>, nttp<T>>);
+
+  static_assert(std::is_same_v<if_indeterminate_c<I, int, long, char>::type, int>);
+  static_assert(std::is_same_v<if_indeterminate_c<T, int, long, char>::type, long>);
+  static_assert(std::is_same_v<if_indeterminate_c<F, int, long, char>::type, char>);
+  CHECK(true);
+}
+
+TEST_CASE("tribool: boost::logic::tribool conversions") {
+  constexpr logic::tribool bt = T;
+  constexpr logic::tribool bf = F;
+  constexpr logic::tribool bi = I;
+  static_assert(bt.value == logic::tribool::true_value);
+  static_assert(bf.value == logic::tribool::false_value);
+  static_assert(bi.value == logic::tribool::indeterminate_value);
+
+  static_assert(tribool{bt} == T && tribool{bf} == F && tribool{bi} == I);
+  static_assert(tribool{logic::tribool(logic::indeterminate)} == I);
+
+  // mixed operators
+  static_assert((T && bi) == I && (bf || T) == T && (I == bi));
+
+  // Boost values as template arguments
+  static_assert(std::is_same_v<nttp<bt>, nttp<T>>);
+  static_assert(
+        std::is_same_v<if_indeterminate_c<protowire::metatypes::indeterminate_value, int,
+                                          long, char>::type,
+                       int>);
+  static_assert(std::is_same_v<
+                if_indeterminate<protowire::metatypes::false_, int, long, char>::type,
+                char>);
+  static_assert(std::is_same_v<
+                if_indeterminate<protowire::metatypes::true_type, int, long, char>::type,
+                long>);
+
+  logic::tribool const runtime = I;
+  CHECK(logic::indeterminate(runtime));
+  CHECK(tribool{runtime} == I);
+}
@@ -0,0 +1,104 @@
+// tests for tribool predicates and fold metafunctions
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool_p.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace logic = boost::logic;
+
+using protowire::metatypes::false_;
+using protowire::metatypes::indeterminate_;
+using protowire::metatypes::true_;
+using protowire::metatypes::tribool_;
+using protowire::metatypes::tribool_all_known;
+using protowire::metatypes::tribool_and;
+using protowire::metatypes::tribool_not;
+using protowire::metatypes::tribool_or;
+
+namespace {
+
+template <typename P>
+constexpr bool is_true = (P::value.value == logic::tribool::true_value);
+
+template <typename P>
+constexpr bool is_false = (P::value.value == logic::tribool::false_value);
+
+template <typename P>
+constexpr bool is_indeterminate = (P::value.value == logic::tribool::indeterminate_value);
+
+/// a predicate which is ill-formed if instantiated
+template <typename T>
+struct never_instantiated {
+  static_assert(!std::is_same_v<T, T>, "predicate should not be instantiated");
+  static constexpr logic::tribool value = logic::tribool(true);
+};
+
+template <std::size_t I>
+using true_at = true_;
+
+template <typename Seq>
+struct long_and;
+
+template <std::size_t... I>
+struct long_and<std::index_sequence<I...>> {
+  using all_true = tribool_and<true_at<I>...>;
+  using one_unknown = tribool_and<true_at<I>..., indeterminate_>;
+  using one_false = tribool_and<true_at<I>..., false_, true_at<I>...>;
+};
+
+}  // namespace
+
+TEST_CASE("tribool folds") {
+  static_assert(is_true<tribool_and<>>);
+  static_assert(is_true<tribool_and<true_, true_>>);
+  static_assert(is_indeterminate<tribool_and<true_, indeterminate_>>);
+  static_assert(is_false<tribool_and<indeterminate_, false_>>);
+
+  static_assert(is_false<tribool_or<>>);
+  static_assert(is_true<tribool_or<indeterminate_, true_>>);
+  static_assert(is_indeterminate<tribool_or<false_, indeterminate_>>);
+  static_assert(is_false<tribool_or<false_, false_>>);
+
+  static_assert(is_false<tribool_not<true_>>);
+  static_assert(is_true<tribool_not<false_>>);
+  static_assert(is_indeterminate<tribool_not<indeterminate_>>);
+
+  static_assert(is_true<tribool_all_known<>>);
+  static_assert(is_true<tribool_all_known<true_, false_>>);
+  static_assert(is_false<tribool_all_known<true_, indeterminate_>>);
+
+  // nested, and derived from tribool_<v>
+  static_assert(is_true<tribool_or<false_, tribool_not<tribool_and<true_, false_>>>>);
+  static_assert(std::is_base_of_v<tribool_<logic::tribool(true)>, tribool_and<true_>>);
+
+  using folds = long_and<std::make_index_sequence<1000>>;
+  static_assert(is_true<folds::all_true>);
+  static_assert(is_indeterminate<folds::one_unknown>);
+  static_assert(is_false<folds::one_false>);
+
+  CHECK(static_cast<bool>(logic::tribool(tribool_and<true_, true_>{})));
+}
+
+TEST_CASE("tribool folds: short-circuit") {
+  // the determining predicate is in the first block of 16
+  using padding =
+        tribool_and<true_, true_, true_, true_, true_, true_, true_, true_, true_, true_,
+                    true_, true_, true_, true_, true_, false_, never_instantiated<int>>;
+  static_assert(is_false<padding>);
+
+  static_assert(is_true<tribool_or<false_, false_, false_, false_, false_, false_, false_,
+                                   false_, false_, false_, false_, false_, false_, false_,
+                                   true_, false_, never_instantiated<int>>>);
+
+  static_assert(is_false<tribool_all_known<
+                      indeterminate_, true_, true_, true_, true_, true_, true_, true_,
+                      true_, true_, true_, true_, true_, true_, true_, true_,
+                      never_instantiated<int>, never_instantiated<long>>>);
+  CHECK(true);
+}
@@ -0,0 +1,119 @@
+// tests for tribool_vector
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/logic/tribool.hpp>
+
+#include <protowire/metatypes/tribool_vector.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace logic = boost::logic;
+
+using protowire::metatypes::false_;
+using protowire::metatypes::false_value;
+using protowire::metatypes::indeterminate_;
+using protowire::metatypes::indeterminate_value;
+using protowire::metatypes::true_;
+using protowire::metatypes::true_value;
+using protowire::metatypes::tribool_vector;
+
+namespace {
+
+bool same(logic::tribool a, logic::tribool b) {
+  return logic::indeterminate(a) ? logic::indeterminate(b)
+                                 : (!logic::indeterminate(b) && bool(a) == bool(b));
+}
+
+std::array<logic::tribool, 3> const logic_values{false_value, indeterminate_value,
+                                                 true_value};
+
+/// vectors `a` and `b` of size `n`, together covering each pair of values
+void fill_pairs(tribool_vector& a, tribool_vector& b, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    a.set(i, logic_values[i % 3]);
+    b.set(i, logic_values[(i / 3) % 3]);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("tribool_vector") {
+  tribool_vector v(130, false_{});
+  CHECK(v.size() == 130);
+  CHECK(v.count(false_value) == 130);
+
+  v.set(0, true_{});
+  v.set(64, indeterminate_{});
+  v.set(129, true_value);
+  CHECK(same(v[0], true_value));
+  CHECK(same(v[64], indeterminate_value));
+  CHECK(same(v.at(129), true_value));
+  CHECK_THROWS_AS(v.at(130), std::out_of_range);
+
+  CHECK(v.count(true_{}) == 2);
+  CHECK(v.count(indeterminate_{}) == 1);
+  CHECK(v.count(false_value) == 127);
+
+  SECTION("resize") {
+    v.resize(200, indeterminate_value);
+    CHECK(v.count(indeterminate_value) == 71);
+    v.resize(65);
+    CHECK(v.count(true_value) == 1);
+    CHECK(v.count(indeterminate_value) == 1);
+    CHECK(v.known_words()[1] == 0);
+  }
+
+  SECTION("fill") {
+    v.fill(indeterminate_value);
+    CHECK(v.count(indeterminate_value) == 130);
+    v.fill(true_value);
+    CHECK(v.count(true_value) == 130);
+    CHECK(v.value_words()[2] == 0b11);
+  }
+}
+
+TEST_CASE("tribool_vector Kleene logic") {
+  // sizes for the word loop, the AVX2 loop and a partial tail word
+  for (std::size_t const n : {9u, 300u, 1000u}) {
+    tribool_vector a(n);
+    tribool_vector b(n);
+    fill_pairs(a, b, n);
+
+    tribool_vector const conj = a & b;
+    tribool_vector const disj = a | b;
+    tribool_vector const neg = ~a;
+    for (std::size_t i = 0; i < n; ++i) {
+      CHECK(same(conj[i], a[i] && b[i]));
+      CHECK(same(disj[i], a[i] || b[i]));
+      CHECK(same(neg[i], !a[i]));
+    }
+    CHECK(~neg == a);
+    CHECK(conj.count(true_value) + conj.count(false_value)
+                + conj.count(indeterminate_value)
+          == n);
+  }
+
+  CHECK_THROWS_AS(tribool_vector(3) & tribool_vector(4), std::length_error);
+}
+
+TEST_CASE("tribool_vector operators reuse an rvalue operand") {
+  tribool_vector a(1000, true_value);
+  tribool_vector const b(1000, false_value);
+
+  auto const* const known = a.known_words().data();
+  auto const* const value = a.value_words().data();
+  tribool_vector c = std::move(a) & b;
+  CHECK(c.known_words().data() == known);
+  CHECK(c.value_words().data() == value);
+
+  tribool_vector d = std::move(c) | b;
+  CHECK(d.known_words().data() == known);
+
+  tribool_vector const e = ~std::move(d);
+  CHECK(e.known_words().data() == known);
+  CHECK(e.count(true_value) == 1000);
+}
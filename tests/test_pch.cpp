@@ -0,0 +1,2 @@
+// translation unit for the precompiled header shared by each test,
+// with PROTOWIRE_UTIL_TEST_PCH
@@ -0,0 +1,108 @@
+// tests for CHECK_STR_FIND and the substring search
+
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <protowire/test/check_str.hpp>
+#include <protowire/util/simd.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace simd = protowire::util::simd;
+
+using protowire::test::check_str::find_chunk_size;
+using protowire::test::check_str::str_find;
+
+namespace {
+
+/// return the offset from simd::find(), as with std::string_view::find()
+std::size_t simd_find(std::string_view haystack, std::string_view needle) {
+  std::size_t const pos =
+        simd::find(haystack.data(), haystack.size(), needle.data(), needle.size());
+  return (pos == simd::npos) ? std::string_view::npos : pos;
+}
+
+}  // namespace
+
+TEST_CASE("simd::find") {
+  std::string_view const str{"ab abc abcd abcde abcdef"};
+  CHECK(simd_find(str, "") == 0);
+  CHECK(simd_find(str, "a") == 0);
+  CHECK(simd_find(str, "abcd") == 7);
+  CHECK(simd_find(str, "abcdef") == 18);
+  CHECK(simd_find(str, "abcdefg") == str.npos);
+  CHECK(simd_find(str, "x") == str.npos);
+  CHECK(simd_find("", "a") == str.npos);
+  CHECK(simd_find("ab", "abc") == str.npos);
+}
+
+TEST_CASE("simd::find, compared to std::string_view::find") {
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<int> byte{'a', 'd'};
+  std::uniform_int_distribution<std::size_t> len{0, 12};
+
+  for (std::size_t n : {0, 1, 15, 16, 17, 31, 32, 33, 100, 1000}) {
+    std::string haystack(n, '\0');
+    for (char& c : haystack) {
+      c = static_cast<char>(byte(gen));
+    }
+    for (int k = 0; k < 50; ++k) {
+      std::string needle(len(gen), '\0');
+      for (char& c : needle) {
+        c = static_cast<char>(byte(gen));
+      }
+      INFO("haystack " << haystack << ", needle " << needle);
+      CHECK(simd_find(haystack, needle) == std::string_view{haystack}.find(needle));
+    }
+  }
+}
+
+TEST_CASE("str_find") {
+  std::string const str{"message { id: 1, name: \"x\" }"};
+  CHECK(!!str_find(str, "id"));
+  CHECK(!!str_find(str, "id", "name", '{'));
+  CHECK(!!str_find(str, ""));
+
+  auto const result = str_find(str, "id", "email", "phone");
+  CHECK(!result);
+  CHECK(result.missing == "email");
+}
+
+// a start position is not a needle, and no other arithmetic type is
+// converted to a char needle
+template <typename... Needles>
+concept str_find_accepts = requires(std::string_view str, Needles... needles) {
+  str_find(str, needles...);
+};
+
+static_assert(str_find_accepts<char const*, char>);
+static_assert(!str_find_accepts<char const*, int>);
+static_assert(!str_find_accepts<char const*, std::size_t>);
+static_assert(!str_find_accepts<signed char>);
+static_assert(!str_find_accepts<double>);
+
+TEST_CASE("str_find, across chunk boundaries") {
+  std::string haystack(find_chunk_size * 3, 'x');
+  haystack.replace(find_chunk_size - 2, 5, "NEEDL");
+  haystack.replace(find_chunk_size * 2 - 1, 3, "ABC");
+  haystack.back() = 'Z';
+
+  CHECK(!!str_find(haystack, "NEEDL", "ABC", "xZ", 'Z'));
+  CHECK(!str_find(haystack, "NEEDLE"));
+  CHECK(!str_find(haystack, "ABC", "xxxxA", "Cx", "ZZ"));
+}
+
+TEST_CASE("CHECK_STR_FIND") {
+  std::string const str{"message { id: 1, name: \"x\" }"};
+  CHECK_STR_FIND(str, "id");
+  CHECK_STR_FIND(str, "id", "name", '}');
+  CHECK_STR_FIND(std::string_view{str}, "name");
+  CHECK_STR_FIND(std::string{"temporary"}, "temp");
+
+  std::vector<std::byte> const bytes{std::byte{0x01}, std::byte{'i'}, std::byte{'d'}};
+  CHECK_STR_FIND(std::span<std::byte const>{bytes}, "id", '\x01');
+}
@@ -0,0 +1,40 @@
+// tests for the lazy messages of failed assertions, as received by a
+// reporter
+//
+// The test cases tagged [.lazy_report] fail, and are run separately in
+// tests/test_tests/CMakeLists.txt, checking the console reporter output
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <protowire/test/typecatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using protowire::test::typecatch::render_lazy_messages;
+
+TEST_CASE("lazy report: render_lazy_messages") {
+  int const value = 42;
+  LAZY_CAPTURE_REPR(value);
+  LAZY_RECORD_TYPE(std::tuple<int, char>);
+
+  std::vector<std::string> const messages = render_lazy_messages();
+  REQUIRE(messages.size() == 2);
+  CHECK(messages[0].starts_with("value := 42"));
+  CHECK(messages[1] == "std::tuple<int, char> := std::tuple<int, char>");
+
+  // the unscoped message applies only to the assertion after it
+  CHECK(render_lazy_messages().size() == 1);
+}
+
+TEST_CASE("lazy report: CHECK", "[.lazy_report]") {
+  int const value = 42;
+  LAZY_CAPTURE_REPR(value);
+  CHECK(value == 0);
+}
+
+TEST_CASE("lazy report: CHECK_TYPE", "[.lazy_report]") {
+  LAZY_RECORD_TYPE(std::tuple<int, char>);
+  CHECK_TYPE(int, char);
+}
@@ -1,4 +1,18 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <protowire/test/object_repr.hpp>
 
@@ -7,8 +21,15 @@
 #include <boost/preprocessor/cat.hpp>
 
 using protowire::util::type_name::type_name;
+using protowire::test::object_repr::byte_format;
 using protowire::test::object_repr::object_repr;
+using protowire::test::object_repr::quote_mode;
+using protowire::test::object_repr::current_repr_limits;
+using protowire::test::object_repr::repr_format_to;
 using protowire::test::object_repr::repr_string;
+using protowire::test::object_repr::repr_write;
+using protowire::test::object_repr::scoped_repr_limits;
+using protowire::test::type_repr::type_repr;
 
 #ifndef TEST_REPR_STRING
 #define TEST_REPR_STRING(value, expect) CHECK(repr_string((value)) == (expect));
@@ -94,3 +115,330 @@ TEST_CASE("object_repr : typographical objects") {
     TEST_OBJECT_REPR_NC(char32_t, U"ABC", "U\"ABC\" /** char32_t* **/");
   }
 }
+
+TEST_CASE("object_repr : scalar and wrapper objects") {
+  TEST_REPR_STRING(42, "42");
+  TEST_REPR_STRING(-7L, "-7");
+  TEST_REPR_STRING(1.5, "1.500000");
+  TEST_REPR_STRING(std::optional<int>{4}, "std::optional<int>{{4}}");
+  TEST_REPR_STRING(std::optional<int>{}, "std::optional<int>{std::nullopt}");
+  TEST_REPR_STRING(std::optional<std::string>{"A"},
+                   "std::optional<std::string>{{std::string{{\"A\"}}}}");
+  TEST_REPR_STRING(nullptr, "nullptr");
+
+  std::string const str{"A\"B"};
+  TEST_REPR_STRING(str, "std::string{{\"A\\\"B\"}} /** std::string const **/");
+
+  std::unique_ptr<int> const ptr = std::make_unique<int>(5);
+  CHECK(repr_string(ptr).starts_with("std::unique_ptr<int"));
+  CHECK(repr_string(ptr).find(">{{5}} /** std::unique_ptr<int") != std::string::npos);
+  CHECK(repr_string(ptr).ends_with("> const **/"));
+}
+
+TEST_CASE("object_repr : output iterators") {
+  std::string buf{};
+  auto out = repr_format_to(std::string{"ABC"}, std::back_inserter(buf));
+  out = repr_format_to(std::u16string_view{u"±"}, out);
+  repr_format_to(std::optional<char>{'x'}, out);
+  CHECK(buf
+        == "std::string{{\"ABC\"}}std::u16string_view{{u\"±\"}}"
+           "std::optional<char>{{'x'}}");
+
+  char arr[32]{};
+  char* const end = repr_format_to(std::string_view{"ABC"}, arr);
+  CHECK(std::string_view{arr, end} == "std::string_view{{\"ABC\"}}");
+
+  std::stringstream stream{};
+  repr_write(std::u8string{u8"±"}, stream);
+  CHECK(stream.str() == "std::u8string{{u8\"±\"}}");
+}
+
+TEST_CASE("object_repr : containers") {
+  std::string const vec_type{type_repr<std::vector<int>>::apply()};
+
+  TEST_REPR_STRING((std::vector<int>{1, 2, 3}), vec_type + "{{1, 2, 3}}");
+  TEST_REPR_STRING(std::vector<int>{}, vec_type + "{{}}");
+  std::string const array_type{type_repr<std::array<char, 2>>::apply()};
+  TEST_REPR_STRING((std::array<char, 2>{'a', 'b'}), array_type + "{{'a', 'b'}}");
+
+  std::map<int, std::string> const map{{1, "a"}, {2, "b"}};
+  CHECK(repr_string(map).find(
+              "{{{1, std::string{{\"a\"}}}, {2, std::string{{\"b\"}}}}}")
+        != std::string::npos);
+
+  // spans are ranges, not smart pointers
+  std::vector<int> const values{4, 5};
+  CHECK(repr_string(std::span<int const>{values}).ends_with("{{4, 5}}"));
+}
+
+TEST_CASE("object_repr : tuples and variants") {
+  TEST_REPR_STRING((std::pair<int, char>{1, 'x'}), "std::pair<int, char>{{1, 'x'}}");
+  TEST_REPR_STRING((std::tuple<int, char, double>{1, 'x', 0.5}),
+                   "std::tuple<int, char, double>{{1, 'x', 0.500000}}");
+  std::string const empty_tuple{type_repr<std::tuple<>>::apply()};
+  TEST_REPR_STRING(std::tuple<>{}, empty_tuple + "{{}}");
+
+  using variant_type = std::variant<std::monostate, int, std::string>;
+  std::string const variant_name{type_repr<variant_type>::apply()};
+  TEST_REPR_STRING(variant_type{}, variant_name + "{{std::monostate{}}}");
+  TEST_REPR_STRING(variant_type{7}, variant_name + "{{7}}");
+  TEST_REPR_STRING(variant_type{"A"}, variant_name + "{{std::string{{\"A\"}}}}");
+}
+
+TEST_CASE("object_repr : element and depth limits") {
+  std::vector<int> const large(100000, 7);
+  std::string const vec_type{type_repr<std::vector<int>>::apply()};
+
+  {
+    scoped_repr_limits const limits{{.max_elements = 3}};
+    CHECK(current_repr_limits().max_elements == 3);
+    TEST_REPR_STRING(large, vec_type + "{{7, 7, 7, ... 99,997 more}} /** " + vec_type
+                                  + " const **/");
+
+    std::list<int> const list{1, 2, 3, 4, 5};
+    CHECK(repr_string(list).find("{{1, 2, 3, ... 2 more}}") != std::string::npos);
+  }
+  CHECK(current_repr_limits().max_elements == 100);
+  CHECK(repr_string(large).find("7, ... 99,900 more}}") != std::string::npos);
+
+  {
+    scoped_repr_limits const limits{{.max_elements = 0}};
+    TEST_REPR_STRING((std::vector<int>{1, 2}), vec_type + "{{... 2 more}}");
+  }
+
+  {
+    using nested = std::vector<std::vector<std::vector<int>>>;
+    scoped_repr_limits const limits{{.max_depth = 2}};
+    std::string const s = repr_string(nested{{{1}}, {{2}}});
+    CHECK(s.find("{...}") != std::string::npos);
+    CHECK(s.find('1') == std::string::npos);
+
+    TEST_REPR_STRING((std::pair<int, std::pair<int, int>>{1, {2, 3}}),
+                     "std::pair<int, std::pair<int, int>>"
+                     "{{1, std::pair<int, int>{{2, 3}}}}");
+  }
+  {
+    scoped_repr_limits const limits{{.max_depth = 1}};
+    TEST_REPR_STRING((std::pair<int, std::pair<int, int>>{1, {2, 3}}),
+                     "std::pair<int, std::pair<int, int>>"
+                     "{{1, std::pair<int, int>{...}}}");
+  }
+}
+
+TEST_CASE("object_repr : escaped text") {
+  SECTION("Control characters, delimiters and invalid UTF-8") {
+    TEST_REPR_STRING(std::string_view{"A\"B\\C"},
+                     "std::string_view{{\"A\\\"B\\\\C\"}}");
+    TEST_REPR_STRING(std::string("\t\n\0\x7f", 4),
+                     "std::string{{\"\\t\\n\\x00\\x7f\"}}");
+    TEST_REPR_STRING(std::string_view{"\xC2\xB1 \xFF\xC2"},
+                     "std::string_view{{\"\xC2\xB1 \\xff\\xc2\"}}");
+    TEST_REPR_STRING(std::u16string_view{u"\"\n"},
+                     "std::u16string_view{{u\"\\\"\\n\"}}");
+    TEST_REPR_STRING('\n', "'\\n'");
+    TEST_REPR_STRING('\'', "'\\''");
+    TEST_REPR_STRING('"', "'\"'");
+    TEST_REPR_STRING(u8'\t', "u8'\\t'");
+  }
+
+  SECTION("Escapes at each offset within a block") {
+    for (std::size_t i = 0; i < 70; ++i) {
+      std::string str(70, 'x');
+      str[i] = '\n';
+      std::string expected = "std::string{{\"" + str + "\"}}";
+      expected.replace(14 + i, 1, "\\n");
+      CHECK(repr_string(std::string{str}) == expected);
+    }
+
+    std::string escaped{};
+    for (int i = 0; i < 200; ++i) {
+      escaped.append("\\x01\xC2\xB1");
+    }
+    std::string binary{};
+    for (int i = 0; i < 200; ++i) {
+      binary.append("\x01\xC2\xB1");
+    }
+    CHECK(repr_string(std::string{binary}) == "std::string{{\"" + escaped + "\"}}");
+  }
+
+  SECTION("Hex quoting") {
+    scoped_repr_limits const limits{{.quoting = quote_mode::hex}};
+    TEST_REPR_STRING(std::string_view("A\0", 2), "std::string_view{{\"\\x41\\x00\"}}");
+    TEST_REPR_STRING(std::u16string_view{u"±"},
+                     "std::u16string_view{{u\"\\xc2\\xb1\"}}");
+    TEST_REPR_STRING('A', "'\\x41'");
+
+    std::string const large(300, 'A');
+    std::string hex{};
+    for (std::size_t i = 0; i < large.size(); ++i) {
+      hex.append("\\x41");
+    }
+    CHECK(repr_string(std::string{large}) == "std::string{{\"" + hex + "\"}}");
+  }
+}
+
+TEST_CASE("object_repr : byte buffers") {
+  std::vector<std::uint8_t> const bytes{0x00, 0x01, 0x7f, 0xff};
+  std::array<std::byte, 2> const arr{std::byte{0xAB}, std::byte{'x'}};
+  std::string const vec_type{type_repr<std::vector<std::uint8_t>>::apply()};
+  std::string const span_type{type_repr<std::span<std::byte const>>::apply()};
+  std::string const empty_type{type_repr<std::vector<std::byte>>::apply()};
+
+  SECTION("Hex") {
+    TEST_REPR_STRING(std::vector<std::uint8_t>{bytes},
+                     vec_type + "{{hex\"00017fff\"}}");
+    TEST_REPR_STRING(std::span<std::byte const>{arr},
+                     span_type + "{{hex\"ab78\"}}");
+    TEST_REPR_STRING(std::vector<std::byte>{}, empty_type + "{{hex\"\"}}");
+
+    // each byte value, as with the SIMD kernel for each block
+    std::vector<std::uint8_t> all(256);
+    std::string hex{};
+    for (std::size_t i = 0; i < all.size(); ++i) {
+      all[i] = static_cast<std::uint8_t>(i);
+      char const digits[] = "0123456789abcdef";
+      hex.push_back(digits[i >> 4]);
+      hex.push_back(digits[i & 0xF]);
+    }
+    CHECK(repr_string(std::vector<std::uint8_t>{all})
+          == vec_type + "{{hex\"" + hex + "\"}}");
+  }
+
+  SECTION("Base64") {
+    scoped_repr_limits const limits{{.bytes = byte_format::base64}};
+    TEST_REPR_STRING(std::vector<std::uint8_t>{bytes},
+                     vec_type + "{{base64\"AAF//w==\"}}");
+    TEST_REPR_STRING(std::span<std::byte const>{arr},
+                     span_type + "{{base64\"q3g=\"}}");
+
+    std::vector<std::uint8_t> const text(600, 'M');
+    std::string encoded{};
+    for (int i = 0; i < 200; ++i) {
+      encoded.append("TU1N");
+    }
+    CHECK(repr_string(std::vector<std::uint8_t>{text})
+          == vec_type + "{{base64\"" + encoded + "\"}}");
+  }
+
+  SECTION("Hexdump") {
+    scoped_repr_limits const limits{{.bytes = byte_format::hexdump}};
+    std::string_view const text{"Hello World.\x0d\x0e\x0f\x10!"};
+    std::span<std::byte const> const span{reinterpret_cast<std::byte const*>(text.data()),
+                                          text.size()};
+    CHECK(repr_string(std::span<std::byte const>{span})
+          == span_type + "{{\n"
+             "00000000  48 65 6c 6c 6f 20 57 6f  72 6c 64 2e 0d 0e 0f 10  "
+             "|Hello World.....|\n"
+             "00000010  21                                                |!|\n"
+             "}}");
+    TEST_REPR_STRING(std::vector<std::byte>{}, empty_type + "{{}}");
+  }
+
+  SECTION("Windowed output") {
+    std::vector<std::uint8_t> large(100000, 0xEE);
+    large.front() = 0x01;
+    large.back() = 0x02;
+
+    scoped_repr_limits const limits{{.max_bytes = 4}};
+    CHECK(repr_string(std::vector<std::uint8_t>{large})
+                .ends_with("{{hex\"01ee\" ... 99,996 bytes ... hex\"ee02\"}}"));
+
+    scoped_repr_limits const dump{{.bytes = byte_format::hexdump, .max_bytes = 64}};
+    std::string const result = repr_string(std::vector<std::uint8_t>{large});
+    CHECK(result.find("{{\n00000000  01 ee") != std::string::npos);
+    CHECK(result.find("\n00000010  ee") != std::string::npos);
+    CHECK(result.find("\n... 99,936 bytes ...\n00018680  ee") != std::string::npos);
+    CHECK(result.ends_with("\n00018690  ee ee ee ee ee ee ee ee  "
+                           "ee ee ee ee ee ee ee 02  |................|\n}}"));
+  }
+
+  SECTION("Small windows") {
+    std::vector<std::uint8_t> lines(64, 0xEE);
+    std::vector<std::uint8_t> partial(40, 0xEE);
+
+    SECTION("Hex") {
+      scoped_repr_limits const none{{.max_bytes = 0}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{bytes},
+                       vec_type + "{{... 4 bytes ...}}");
+      TEST_REPR_STRING(std::vector<std::uint8_t>{lines},
+                       vec_type + "{{... 64 bytes ...}}");
+
+      scoped_repr_limits const one{{.max_bytes = 1}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{bytes},
+                       vec_type + "{{... 3 bytes ... hex\"ff\"}}");
+
+      scoped_repr_limits const sixteen{{.max_bytes = 16}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{bytes},
+                       vec_type + "{{hex\"00017fff\"}}");
+      TEST_REPR_STRING(std::vector<std::uint8_t>{partial},
+                       vec_type + "{{hex\"eeeeeeeeeeeeeeee\" ... 24 bytes ... "
+                                  "hex\"eeeeeeeeeeeeeeee\"}}");
+    }
+
+    SECTION("Hexdump") {
+      std::string const line{"ee ee ee ee ee ee ee ee  ee ee ee ee ee ee ee ee  "
+                             "|................|\n"};
+
+      scoped_repr_limits const none{{.bytes = byte_format::hexdump, .max_bytes = 0}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{lines},
+                       vec_type + "{{\n... 64 bytes ...\n}}");
+
+      scoped_repr_limits const one{{.bytes = byte_format::hexdump, .max_bytes = 1}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{partial},
+                       vec_type + "{{\n... 40 bytes ...\n}}");
+
+      scoped_repr_limits const two{{.bytes = byte_format::hexdump, .max_bytes = 2}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{partial},
+                       vec_type + "{{\n... 40 bytes ...\n}}");
+
+      scoped_repr_limits const sixteen{{.bytes = byte_format::hexdump, .max_bytes = 16}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{lines},
+                       vec_type + "{{\n... 64 bytes ...\n}}");
+      TEST_REPR_STRING(std::vector<std::uint8_t>{partial},
+                       vec_type + "{{\n... 32 bytes ...\n"
+                                  "00000020  ee ee ee ee ee ee ee ee"
+                                  "                           |........|\n}}");
+
+      scoped_repr_limits const lines32{{.bytes = byte_format::hexdump, .max_bytes = 32}};
+      TEST_REPR_STRING(std::vector<std::uint8_t>{lines},
+                       vec_type + "{{\n00000000  " + line + "... 32 bytes ...\n00000030  "
+                             + line + "}}");
+    }
+
+    SECTION("Omitted count") {
+      // for each window, the bytes written and omitted are each byte of
+      // the buffer
+      for (byte_format const format : {byte_format::hex, byte_format::hexdump}) {
+        for (std::size_t const max_bytes : {0u, 1u, 2u, 15u, 16u, 17u, 32u}) {
+          scoped_repr_limits const limits{{.bytes = format, .max_bytes = max_bytes}};
+          for (std::size_t const n : {0u, 1u, 15u, 16u, 17u, 40u, 64u}) {
+            std::vector<std::uint8_t> const buf(n, 0xEE);
+            std::string const result = repr_string(std::vector<std::uint8_t>{buf});
+            std::size_t const marker = result.find("... ");
+            CAPTURE(format == byte_format::hex, max_bytes, n, result);
+            CHECK((marker != std::string::npos) == (n > max_bytes));
+            std::size_t written = 0;
+            if (format == byte_format::hex) {
+              for (std::size_t i = 0; (i = result.find("ee", i)) != std::string::npos;
+                   i += 2) {
+                ++written;
+              }
+            } else {
+              for (char const c : result) {
+                written += (c == '.');
+              }
+            }
+            if (marker != std::string::npos) {
+              std::size_t const omitted = std::stoul(result.substr(marker + 4));
+              CHECK(omitted != 0);
+              // for hexdump, each '.' in the marker is counted as written
+              CHECK(omitted + written - ((format == byte_format::hexdump) ? 6 : 0) == n);
+            } else {
+              CHECK(written == n);
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,234 @@
+// tests for repr_arena, inline_repr and repr_scratch
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <protowire/test/object_repr.hpp>
+#include <protowire/test/repr_arena.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using protowire::test::object_repr::inline_repr;
+using protowire::test::object_repr::repr_arena;
+using protowire::test::object_repr::repr_inline;
+using protowire::test::object_repr::repr_scratch;
+using protowire::test::object_repr::repr_string;
+using protowire::test::object_repr::scratch_retain_size;
+using protowire::test::object_repr::with_repr_view;
+
+// allocation counting, for this test program
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+std::size_t allocations() noexcept {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+/// counted allocation for both operator new and operator new[], each
+/// paired with std::free in the operator delete forms
+void* counted_malloc(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* const p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size) {
+  return counted_malloc(size);
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+TEST_CASE("repr_arena : representations") {
+  repr_arena arena{};
+  std::string const str{"A\"B"};
+  std::optional<int> const opt{4};
+
+  std::string_view const a = arena.repr(42);
+  std::string_view const b = arena.repr(str);
+  std::string_view const c = arena.repr(opt);
+  std::string_view const d = arena.repr("ABC");
+  CHECK(a == repr_string(42));
+  CHECK(b == repr_string(str));
+  CHECK(c == repr_string(opt));
+  CHECK(d == repr_string("ABC"));
+  CHECK(arena.used() == a.size() + b.size() + c.size() + d.size());
+
+  arena.reset();
+  CHECK(arena.used() == 0);
+}
+
+TEST_CASE("repr_arena : block overflow") {
+  repr_arena arena{64};
+  std::string const large(1000, 'x');
+
+  std::string_view const first = arena.repr(12345);
+  std::string_view const second = arena.repr(large);
+  std::string_view const third = arena.repr(std::string{"ABC"});
+  CHECK(first == "12345");
+  CHECK(second == repr_string(large));
+  CHECK(third == repr_string(std::string{"ABC"}));
+  CHECK(arena.capacity() > 1000);
+
+  std::size_t const capacity = arena.capacity();
+  arena.reset();
+  CHECK(arena.capacity() == capacity);
+  CHECK(arena.repr(large) == repr_string(large));
+}
+
+TEST_CASE("inline_repr : representations") {
+  std::string const str{"ABC"};
+  inline_repr<> const r = repr_inline(str);
+  CHECK(r.view() == repr_string(str));
+  CHECK(r.is_inline());
+
+  inline_repr<8> const spilled = repr_inline<8>(str);
+  CHECK(spilled.view() == repr_string(str));
+  CHECK(!spilled.is_inline());
+
+  std::ostringstream stream{};
+  stream << repr_inline(std::optional<char>{'x'});
+  CHECK(stream.str() == "std::optional<char>{{'x'}}");
+}
+
+TEST_CASE("repr_arena : no allocation after warmup") {
+  std::vector<std::string> const fields{"id", "name", "email", "a longer field value"};
+  std::optional<long> const opt{-7};
+
+  repr_arena arena{256};
+  auto const cycle = [&]() {
+    std::size_t total = 0;
+    for (int i = 0; i < 100; ++i) {
+      total += arena.repr(i).size();
+      total += arena.repr(opt).size();
+      for (std::string const& f : fields) {
+        total += arena.repr(f).size();
+      }
+    }
+    arena.reset();
+    return total;
+  };
+
+  // warmup, for arena blocks and memoized type names
+  std::size_t const expected = cycle();
+  cycle();
+
+  std::size_t const before = allocations();
+  std::size_t const total = cycle() + cycle();
+  std::size_t const after = allocations();
+  CHECK(total == expected * 2);
+  CHECK(after - before == 0);
+}
+
+TEST_CASE("inline_repr : no allocation for short representations") {
+  std::string const str{"field_name"};
+  std::optional<int> const opt{4};
+  static_cast<void>(repr_inline(opt));
+
+  std::size_t const before = allocations();
+  std::size_t total = 0;
+  for (int i = 0; i < 100; ++i) {
+    total += repr_inline(i).size() + repr_inline(str).size() + repr_inline(opt).size();
+  }
+  std::size_t const after = allocations();
+  CHECK(total > 0);
+  CHECK(after - before == 0);
+}
+
+TEST_CASE("repr_scratch : reuse") {
+  char const* data = nullptr;
+  {
+    repr_scratch outer{};
+    outer.buffer().assign(100, 'x');
+    data = outer.view().data();
+    {
+      // a nested scratch buffer is separate
+      repr_scratch inner{};
+      CHECK(inner.view().empty());
+      inner.buffer().assign("inner");
+      CHECK(outer.view() == std::string(100, 'x'));
+    }
+  }
+  {
+    // cleared, retaining storage
+    repr_scratch again{};
+    CHECK(again.view().empty());
+    CHECK(again.buffer().capacity() >= 100);
+    CHECK(again.view().data() == data);
+  }
+  {
+    repr_scratch large{};
+    large.buffer().assign(scratch_retain_size + 1, 'x');
+  }
+  repr_scratch after{};
+  CHECK(after.buffer().capacity() <= scratch_retain_size);
+
+  std::optional<int> const opt{4};
+  CHECK(with_repr_view(opt, [](std::string_view s) { return std::string{s}; })
+        == repr_string(std::optional<int>{4}));
+}
+
+TEST_CASE("repr_scratch : one allocation for repr_string, after warmup") {
+  std::vector<std::string> const fields(50, std::string{"a field value"});
+  // warmup, for the scratch buffer and memoized type names
+  std::string const expected = repr_string(fields);
+
+  std::size_t const before = allocations();
+  std::string const result = repr_string(fields);
+  std::size_t const after = allocations();
+  CHECK(result == expected);
+  CHECK(after - before == 1);
+}
+
+TEST_CASE("repr_scratch : concurrent representations") {
+  std::vector<std::string> const fields{"id", "name", "email", "a longer field value"};
+  std::string const expected = repr_string(std::vector<std::string>{fields});
+  unsigned const thread_count = std::max(2u, std::thread::hardware_concurrency());
+
+  std::atomic<std::size_t> matched{0};
+  std::vector<std::thread> threads{};
+  for (unsigned t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&fields, &expected, &matched] {
+      std::size_t n = 0;
+      for (int i = 0; i < 200; ++i) {
+        n += (repr_string(std::vector<std::string>{fields}) == expected) ? 1 : 0;
+      }
+      matched.fetch_add(n, std::memory_order_relaxed);
+    });
+  }
+  for (std::thread& th : threads) {
+    th.join();
+  }
+  CHECK(matched.load() == thread_count * 200);
+}
@@ -0,0 +1,59 @@
+#include <iterator>
+#include <optional>
+#include <string>
+
+#include <protowire/test/repr_format.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+struct string_repr_t {};
+
+// a specialization returning a std::string, longer than any small string buffer
+template <>
+struct protowire::test::type_repr::type_repr<string_repr_t> {
+  static std::string apply() { return "string_repr_t, with a computed representation"; }
+};
+
+using protowire::test::object_repr::repr_string;
+using protowire::test::repr_format::repr;
+using protowire::test::repr_format::repr_type;
+
+#if defined(__cpp_lib_format)
+
+TEST_CASE("repr_format : std::format") {
+  std::optional<std::string> value{"ABC"};
+
+  CHECK(std::format("{}", repr{value}) == repr_string(value));
+  CHECK(std::format("{} := {}", repr_type<int const&>{}, repr{42}) == "int const& := 42");
+
+  std::string buf{};
+  std::format_to(std::back_inserter(buf), "[{}]", repr{std::u8string_view{u8"±"}});
+  CHECK(buf == "[std::u8string_view{{u8\"±\"}}]");
+
+  CHECK(std::format("[{:>6}]", repr{7}) == "[     7]");
+  CHECK(std::format("[{:.3}]", repr_type<std::string>{}) == "[std]");
+  CHECK(std::format("{}", repr_type<string_repr_t>{})
+        == protowire::test::type_repr::type_repr<string_repr_t>::apply());
+}
+
+#endif
+
+#if defined(PROTOWIRE_REPR_FMT)
+
+TEST_CASE("repr_format : fmt::format") {
+  std::optional<std::string> value{"ABC"};
+
+  CHECK(fmt::format("{}", repr{value}) == repr_string(value));
+  CHECK(fmt::format("{} := {}", repr_type<int const&>{}, repr{42}) == "int const& := 42");
+
+  std::string buf{};
+  fmt::format_to(std::back_inserter(buf), "[{}]", repr{std::u8string_view{u8"±"}});
+  CHECK(buf == "[std::u8string_view{{u8\"±\"}}]");
+
+  CHECK(fmt::format("[{:>6}]", repr{7}) == "[     7]");
+  CHECK(fmt::format("[{:.3}]", repr_type<std::string>{}) == "[std]");
+  CHECK(fmt::format("{}", repr_type<string_repr_t>{})
+        == protowire::test::type_repr::type_repr<string_repr_t>::apply());
+}
+
+#endif
@@ -1,4 +1,9 @@
 
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <protowire/test/type_repr.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -9,6 +14,14 @@ struct custom_unary_t {};
 template <typename... Args>
 struct custom_nary_t {};
 
+struct string_repr_t {};
+
+// a specialization returning a std::string, longer than any small string buffer
+template <>
+struct protowire::test::type_repr::type_repr<string_repr_t> {
+  static std::string apply() { return "string_repr_t, with a computed representation"; }
+};
+
 using protowire::test::type_repr::type_repr;
 
 TEST_CASE("type_repr for standard types") {
@@ -39,3 +52,28 @@ TEST_CASE("type_repr for arbitrary template parameter pack") {
   CHECK(type_repr<custom_nary_t<int const*, char const*>>::apply()
         == "custom_nary_t<int const*, char const*>");
 }
+
+TEST_CASE("type_repr memoization") {
+  using repr_t = type_repr<std::optional<std::vector<int>> const*>;
+  std::string_view const first = repr_t::apply();
+  std::string_view const second = repr_t::apply();
+
+  CHECK(first == repr_t::build());
+  CHECK(first.data() == second.data());
+  CHECK(type_repr<int const&>::apply().data() == type_repr<int const&>::apply().data());
+}
+
+TEST_CASE("type_repr with a std::string specialization") {
+  using protowire::test::type_repr::has_type_repr;
+  static_assert(has_type_repr<string_repr_t>);
+
+  std::string const name = type_repr<string_repr_t>::apply();
+  CHECK(type_repr<string_repr_t const>::apply() == name + " const");
+  CHECK(type_repr<string_repr_t*>::apply() == name + "*");
+  CHECK(type_repr<string_repr_t const*>::apply() == name + " const*");
+  CHECK(type_repr<string_repr_t&>::apply() == name + "&");
+  CHECK(type_repr<string_repr_t const&>::apply() == name + " const&");
+  CHECK(type_repr<string_repr_t&&>::apply() == name + "&&");
+  CHECK(type_repr<custom_unary_t<string_repr_t const*>>::apply()
+        == "custom_unary_t<" + name + " const*>");
+}
@@ -1,6 +1,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <boost/mpl/vector.hpp>
 
@@ -81,3 +82,83 @@ TEST_CASE("typecatch CAPTURE_REPR, RECORD_REPR") {
   CAPTURE_REPR("ABC");
   RECORD_REPR("ABC");
 }
+
+// lazy messages
+
+namespace {
+
+/// a type counting each representation
+struct counted {
+  static inline int repr_count = 0;
+};
+
+}  // namespace
+
+template <>
+struct protowire::test::object_repr::object_repr<counted>
+      : repr_interface<object_repr<counted>, counted> {
+  template <typename OutIt>
+  static OutIt format_to(counted const&, OutIt out) {
+    ++counted::repr_count;
+    *out++ = 'C';
+    return out;
+  }
+};
+
+TEST_CASE("typecatch LAZY_CAPTURE_REPR, LAZY_RECORD_REPR") {
+  counted const ob{};
+  std::string const str{"ABC"};
+  counted::repr_count = 0;
+  {
+    LAZY_CAPTURE_REPR(ob);
+    LAZY_CAPTURE_REPR(std::string{"temporary"});
+    LAZY_RECORD_REPR(str);
+    LAZY_RECORD_REPR(ob);
+    CHECK(str.size() == 3);
+    CHECK(str.size() == 3);
+  }
+  CHECK(counted::repr_count == 0);
+
+#if PROTOWIRE_LAZY_LISTENER_MESSAGES
+  // messages are rendered for a failed assertion
+  {
+    LAZY_CAPTURE_REPR(ob);
+    CHECK_NOFAIL(str.empty());
+  }
+  CHECK(counted::repr_count == 1);
+
+  LAZY_RECORD_REPR(ob);
+  CHECK_NOFAIL(str.empty());
+  CHECK_NOFAIL(str.empty());
+  CHECK(counted::repr_count == 2);
+  counted::repr_count = 0;
+#endif
+
+  // messages rendered in a failure branch are not rendered again
+  {
+    LAZY_CAPTURE_REPR(ob);
+    LAZY_UNSCOPED_INFO();
+    CHECK_NOFAIL(str.empty());
+  }
+  CHECK(counted::repr_count == 1);
+}
+
+TEST_CASE("typecatch LAZY_CAPTURE_TYPE, LAZY_RECORD_TYPE") {
+  LAZY_CAPTURE_TYPE(std::vector<int>);
+  LAZY_RECORD_TYPE(std::tuple<int, char>);
+  CHECK_TYPE(int, int);
+}
+
+TEST_CASE("typecatch lazy_message") {
+  using protowire::test::typecatch::lazy_message;
+  namespace detail = protowire::test::typecatch::detail;
+
+  std::string const str{"ABC"};
+  lazy_message const msg{"LAZY_CAPTURE_REPR", CATCH_INTERNAL_LINEINFO, "str", &str,
+                         &detail::render_repr<std::string const&>};
+  CHECK(msg.str() == "str := " + protowire::test::object_repr::repr_string(str));
+
+  lazy_message const type_msg{"LAZY_CAPTURE_TYPE", CATCH_INTERNAL_LINEINFO, "T", nullptr,
+                              &detail::render_type<int>};
+  CHECK(type_msg.str() == "T := int");
+}
@@ -1,6 +1,9 @@
 // unit tests for type_name
 
+#include <map>
+#include <optional>
 #include <string>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <protowire/test/check_str.hpp>
 
@@ -19,3 +22,49 @@ TEST_CASE("type_name") {
 
   CHECK(type_name<char const* const>::apply() == "char const* const");
 }
+
+TEST_CASE("type_name constexpr value") {
+  using protowire::util::type_name::constexpr_names;
+
+  CHECKED_IF(constexpr_names) {
+    CHECK(type_name<int>::value == "int");
+    CHECK(type_name<int const&>::value == "int const&");
+    CHECK(type_name<char const* const>::value == "char const* const");
+    CHECK(type_name<std::string>::value.find("string") != std::string_view::npos);
+    CHECK(type_name<std::string>::value.data()[type_name<std::string>::value.size()]
+          == '\0');
+  }
+
+  CHECK(type_name<int const&&>::view() == "int const&&");
+  CHECK(type_name<char const*>::view().data() == type_name<char const*>::view().data());
+}
+
+TEST_CASE("type_name nested cv-qualifiers") {
+  using protowire::util::type_name::constexpr_names;
+
+  CHECKED_IF(constexpr_names) {
+    CHECK(type_name<std::optional<int const>>::value == "std::optional<int const>");
+    CHECK(type_name<std::optional<int const volatile>>::value
+          == "std::optional<int const volatile>");
+    CHECK(type_name<std::optional<std::optional<int const> const>>::value
+          == "std::optional<std::optional<int const> const>");
+    CHECK(type_name<std::vector<char const* const*>>::value.find("<char const* const*")
+          != std::string_view::npos);
+    CHECK(type_name<int (*)(int, char const*)>::value == "int (*)(int, char const*)");
+
+    using map_type = std::map<int, char const*>;
+    CHECK_STR_FIND(type_name<map_type>::value, "std::map<int, char const*");
+    CHECK_STR_FIND(type_name<map_type const>::value, " const");
+    CHECK(type_name<map_type>::value.find("const ") == std::string_view::npos);
+    CHECK(type_name<map_type>::value.data()[type_name<map_type>::value.size()] == '\0');
+
+#if defined(__GNUC__) && !defined(__clang__)
+    // GCC omits default template arguments
+    CHECK(type_name<map_type>::value == "std::map<int, char const*>");
+    CHECK(type_name<map_type const>::value == "std::map<int, char const*> const");
+    CHECK(type_name<std::vector<char const* const*>>::value
+          == "std::vector<char const* const*>");
+    CHECK(type_name<std::string>::value == "std::__cxx11::basic_string<char>");
+#endif
+  }
+}
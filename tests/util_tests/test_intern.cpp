@@ -0,0 +1,113 @@
+// tests for the string intern pool
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <protowire/util/intern.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using protowire::util::intern::global_pool;
+using protowire::util::intern::intern_pool;
+using protowire::util::intern::intern_seed;
+using protowire::util::intern::intern_stats;
+using protowire::util::intern::interned;
+using protowire::util::intern::interned_literal;
+using protowire::util::lstring::LString;
+
+namespace {
+
+// seeded during static initialization
+intern_seed<"seeded_id", "seeded_name"> const seeds{};
+
+}  // namespace
+
+TEST_CASE("intern_pool") {
+  intern_pool pool{};
+
+  std::string const text{"field_name"};
+  interned const a = pool.intern(text);
+  interned const b = pool.intern(std::string_view{"field_name"});
+  interned const c = pool.intern(LString{"other"});
+
+  CHECK(a == b);
+  CHECK(a != c);
+  CHECK(a.view() == "field_name");
+  CHECK(a.view().data() != text.data());
+  CHECK(std::string_view{a.c_str()} == "field_name");
+  CHECK(std::hash<interned>{}(a) == std::hash<interned>{}(b));
+
+  SECTION("empty handles and strings") {
+    interned const empty{};
+    interned const empty_str = pool.intern("");
+    CHECK_FALSE(empty);
+    CHECK(empty.view().empty());
+    CHECK(empty_str);
+    CHECK(empty_str.size() == 0);
+    CHECK(empty != empty_str);
+    CHECK_FALSE(pool.find("not interned"));
+    CHECK(pool.find("field_name") == a);
+  }
+
+  SECTION("stats") {
+    intern_stats const st = pool.stats();
+    CHECK(st.lookups == 3);
+    CHECK(st.hits == 1);
+    CHECK(st.strings == 2);
+    CHECK(st.string_bytes == text.size() + 5);
+    CHECK(st.arena_bytes >= st.string_bytes);
+    CHECK(st.hit_rate() > 0.3);
+    CHECK(st.hit_rate() < 0.4);
+  }
+
+  SECTION("large strings") {
+    std::string const large(100000, 'x');
+    interned const h = pool.intern(large);
+    CHECK(h.view() == large);
+    CHECK(pool.intern(large) == h);
+    CHECK(a.view() == "field_name");
+  }
+}
+
+TEST_CASE("intern_pool concurrency") {
+  intern_pool pool{};
+  constexpr std::size_t thread_count = 8;
+  constexpr std::size_t key_count = 2000;
+
+  std::vector<std::vector<interned>> results(thread_count);
+  std::vector<std::thread> threads{};
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&pool, &results, t] {
+      results[t].reserve(key_count);
+      for (std::size_t i = 0; i < key_count; ++i) {
+        results[t].push_back(pool.intern("key_" + std::to_string(i)));
+      }
+    });
+  }
+  for (std::thread& th : threads) {
+    th.join();
+  }
+
+  for (std::size_t t = 1; t < thread_count; ++t) {
+    REQUIRE(results[t] == results[0]);
+  }
+  std::unordered_set<interned> const unique{results[0].begin(), results[0].end()};
+  CHECK(unique.size() == key_count);
+  CHECK(results[0][42].view() == "key_42");
+
+  intern_stats const st = pool.stats();
+  CHECK(st.strings == key_count);
+  CHECK(st.lookups == thread_count * key_count);
+  CHECK(st.hits == (thread_count - 1) * key_count);
+}
+
+TEST_CASE("global intern pool") {
+  CHECK(global_pool().find("seeded_id") == interned_literal<"seeded_id">());
+  CHECK(global_pool().find("seeded_name"));
+  CHECK(protowire::util::intern::intern("seeded_name")
+        == interned_literal<"seeded_name">());
+}
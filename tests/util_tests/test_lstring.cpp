@@ -1,13 +1,25 @@
 
 
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <compare>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 
 #include <protowire/util/lstring.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+using protowire::util::lstring::fnv1a_hash;
+using protowire::util::lstring::join;
 using protowire::util::lstring::LBasicString;
+using protowire::util::lstring::lstring_hash_v;
+using protowire::util::lstring::lstring_hasher;
+using protowire::util::lstring::to_lstring;
+using protowire::util::lstring::xxh64_hash;
 using protowire::util::lstring::LString;
 using protowire::util::lstring::WString;
 using protowire::util::lstring::U8String;
@@ -182,3 +194,126 @@ TEST_CASE("U8String") {
   CHECK(data_t::cmp(data_t{}));
   CHECK(!data_t::cmp(other_t{}));
 }
+
+TEST_CASE("LBasicString content comparison") {
+  // distinct objects with equal content
+  LString const a{"abc"};
+  LString const b{"abc"};
+  LString const c{"abd"};
+  CHECK(a == b);
+  CHECK(!(a == c));
+  CHECK(a != c);
+  CHECK(a == std::string_view{"abc"});
+  CHECK(a != std::string_view{"abc\0", 4});
+  CHECK(std::string{"abc"} == a);
+
+  WString const wa{L"abc"};
+  WString const wb{L"abc"};
+  CHECK(wa == wb);
+
+  static_assert(LString{"abc"} == LString{"abc"});
+  static_assert(LString{"abc"} != LString{"abcd"});
+  static_assert(LString{"abc"} < LString{"abd"});
+  static_assert(LString{"ab"} < LString{"abc"});
+  static_assert((LString{"abc"} <=> std::string_view{"abc"}) == 0);
+
+  SECTION("long strings") {
+    LString const long_a{"0123456789abcdef0123456789abcdef"
+                         "0123456789abcdef0123456789abcdef"};
+    LString const long_b{"0123456789abcdef0123456789abcdef"
+                         "0123456789abcdef0123456789abcdef"};
+    LString const long_c{"0123456789abcdef0123456789abcdef"
+                         "0123456789abcdef0123456789abcdeF"};
+    CHECK(long_a == long_b);
+    CHECK(long_a != long_c);
+    CHECK(long_c < long_a);
+    CHECK((long_a <=> long_b) == std::strong_ordering::equal);
+    CHECK((long_a <=> std::string_view{long_c.data}) == std::strong_ordering::greater);
+  }
+
+  SECTION("ordering") {
+    // unsigned comparison, as with std::char_traits<char>
+    CHECK(LString{"a"} < LString{"\xff"});
+    CHECK(U8String<3>{u8"ab"} < U8String<3>{u8"b\0"});
+
+    std::array<std::string_view, 4> keys{"delta", "alpha", "charlie", "bravo"};
+    std::sort(keys.begin(), keys.end(),
+              [](auto const& x, auto const& y) { return x < y; });
+    CHECK(LString{"alpha"} == keys[0]);
+    CHECK(std::is_eq(LString{"bravo"} <=> keys[1]));
+    CHECK(LString{"bravo"} < keys[2]);
+  }
+}
+
+TEST_CASE("LBasicString hashing") {
+  // reference values for FNV-1a (64 bit) and XXH64 (seed 0)
+  static_assert(LString{""}.hash<fnv1a_hash>() == 0xCBF29CE484222325u);
+  static_assert(LString{"a"}.hash<fnv1a_hash>() == 0xAF63DC4C8601EC8Cu);
+  static_assert(LString{""}.hash<xxh64_hash>() == 0xEF46DB3751D8E999u);
+  static_assert(LString{"a"}.hash<xxh64_hash>() == 0xD24EC4F1A98C6E5Bu);
+  static_assert(LString{"abc"}.hash<xxh64_hash>() == 0x44BC2CF5AD770999u);
+
+  static_assert(lstring_hash_v<"abc"> == LString{"abc"}.hash());
+  static_assert(lstring_hash_v<"abc"> != lstring_hash_v<"abd">);
+
+  SECTION("runtime hash is consistent with the literal hash") {
+    std::string const short_str{"field_name"};
+    std::string const long_str{
+          "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef+-"};
+    CHECK(lstring_hasher<>{}(std::string_view{short_str})
+          == lstring_hash_v<"field_name">);
+    CHECK(lstring_hasher<>{}(short_str) == lstring_hash_v<"field_name">);
+    CHECK(lstring_hasher<>{}(short_str.c_str()) == lstring_hash_v<"field_name">);
+    CHECK(lstring_hasher<xxh64_hash>{}(std::string_view{short_str})
+          == lstring_hash_v<"field_name", xxh64_hash>);
+    CHECK(lstring_hasher<xxh64_hash>{}(long_str)
+          == lstring_hash_v<"0123456789abcdef0123456789abcdef0123456789abcdef"
+                            "0123456789abcdef+-",
+                            xxh64_hash>);
+    CHECK(lstring_hasher<xxh64_hash>{}(std::u16string_view{u"wide"})
+          == lstring_hash_v<u"wide", xxh64_hash>);
+    CHECK(lstring_hasher<>{}(std::wstring{L"wide"}) == lstring_hash_v<L"wide">);
+  }
+
+  SECTION("transparent lookup") {
+    std::unordered_set<std::string, lstring_hasher<>, std::equal_to<>> names{"alpha",
+                                                                             "bravo"};
+    CHECK(names.contains(std::string_view{"alpha"}));
+    CHECK_FALSE(names.contains(std::string_view{"charlie"}));
+  }
+}
+
+template <LString Name>
+constexpr std::string_view name_view() {
+  return Name.view();
+}
+
+TEST_CASE("LBasicString composition") {
+  constexpr LString inner{"int"};
+  constexpr auto name = "std::optional<" + inner + ">";
+  static_assert(std::is_same_v<decltype(name), LBasicString<19, char> const>);
+  static_assert(name == std::string_view{"std::optional<int>"});
+  static_assert(LString{"ab"} + LString{"cd"} == std::string_view{"abcd"});
+  static_assert(LString{""} + "" == std::string_view{});
+
+  static_assert(name.substr<5, 8>() == std::string_view{"optional"});
+  static_assert(name.substr<14>() == std::string_view{"int>"});
+  static_assert(name.substr<18>().size() == 0);
+
+  static_assert(join<", ">(LString{"int"}, LString{"char"}, LString{"long"})
+                == std::string_view{"int, char, long"});
+  static_assert(join<", ">(LString{"int"}) == std::string_view{"int"});
+  static_assert(join<", ">().size() == 0);
+  static_assert(join<L"::">(WString{L"std"}, WString{L"string"})
+                == std::wstring_view{L"std::string"});
+
+  static_assert(to_lstring<0>() == std::string_view{"0"});
+  static_assert(to_lstring<-42>() == std::string_view{"-42"});
+  static_assert(to_lstring<LLONG_MIN>() == std::string_view{"-9223372036854775808"});
+  static_assert(to_lstring<ULLONG_MAX>() == std::string_view{"18446744073709551615"});
+  static_assert(to_lstring<7, char8_t>() == std::u8string_view{u8"7"});
+
+  // composed strings as template arguments
+  CHECK(name_view<"std::array<int, " + to_lstring<4>() + ">">() == "std::array<int, 4>");
+  CHECK(name_view<name>() == "std::optional<int>");
+}
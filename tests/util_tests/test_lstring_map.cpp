@@ -0,0 +1,65 @@
+// tests for lstring_map
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+#include <protowire/util/lstring_map.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using protowire::util::lstring::basic_lstring_map;
+using protowire::util::lstring::lstring_kv;
+using protowire::util::lstring::lstring_map;
+using protowire::util::lstring::xxh64_hash;
+
+#define TEST_KEY_COUNT 200
+#define TEST_KEY(n) BOOST_PP_STRINGIZE(BOOST_PP_CAT(field_name_, n))
+#define TEST_ENTRY(z, n, _) lstring_kv{TEST_KEY(n), n}
+
+using fields = lstring_map<{"id", 1}, {"name", 2}, {"email", 3}>;
+
+using large_map = lstring_map<BOOST_PP_ENUM(TEST_KEY_COUNT, TEST_ENTRY, _)>;
+
+TEST_CASE("lstring_map") {
+  static_assert(fields::size() == 3);
+  static_assert(fields::get<"name">() == 2);
+  static_assert(fields::index_of("email") == 2);
+  static_assert(!fields::contains("mail"));
+
+  std::string const name{"name"};
+  REQUIRE(fields::find(name) != nullptr);
+  CHECK(*fields::find(name) == 2);
+  CHECK(fields::find(std::string_view{"names"}) == nullptr);
+  CHECK(fields::find(std::string_view{}) == nullptr);
+  CHECK(fields::at("id") == 1);
+  CHECK_THROWS_AS(fields::at("ID"), std::out_of_range);
+  CHECK(fields::keys[1] == "name");
+
+  SECTION("single entry") {
+    using single = lstring_map<{"only", 'x'}>;
+    CHECK(single::at("only") == 'x');
+    CHECK_FALSE(single::contains("other"));
+  }
+
+  SECTION("wide keys, with a hash policy") {
+    using wide = basic_lstring_map<xxh64_hash, lstring_kv{u"alpha", 1.5},
+                                   lstring_kv{u"bravo", 2.5}>;
+    CHECK(wide::at(u"bravo") == 2.5);
+    CHECK(wide::find(u"charlie") == nullptr);
+  }
+
+  SECTION("many entries") {
+    static_assert(large_map::size() == TEST_KEY_COUNT);
+#define TEST_LOOKUP(z, n, _) CHECK(large_map::index_of(std::string{TEST_KEY(n)}) == n);
+    BOOST_PP_REPEAT(TEST_KEY_COUNT, TEST_LOOKUP, _)
+#undef TEST_LOOKUP
+    CHECK_FALSE(large_map::contains("field_name_"));
+    CHECK_FALSE(large_map::contains("field_name_200"));
+  }
+}
@@ -0,0 +1,112 @@
+// tests for UTF transcoding
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <protowire/util/utf.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace utf = protowire::util::utf;
+
+namespace {
+
+template <typename CharT>
+std::string to_utf8(std::basic_string_view<CharT> s) {
+  std::string result{};
+  utf::to_utf8(s.data(), s.size(), [&result](std::string_view segment) {
+    result.append(segment);
+  });
+  return result;
+}
+
+std::string to_utf8(char8_t const* s) {
+  return to_utf8(std::u8string_view{s});
+}
+
+std::string to_utf8(char16_t const* s) {
+  return to_utf8(std::u16string_view{s});
+}
+
+std::string to_utf8(char32_t const* s) {
+  return to_utf8(std::u32string_view{s});
+}
+
+std::string to_utf8(wchar_t const* s) {
+  return to_utf8(std::wstring_view{s});
+}
+
+std::string as_string(std::u8string_view s) {
+  return std::string{reinterpret_cast<char const*>(s.data()), s.size()};
+}
+
+/// return `s`, repeated with an ASCII prefix of each length in [0, n)
+template <typename CharT>
+std::basic_string<CharT> with_prefixes(std::basic_string_view<CharT> s, std::size_t n) {
+  std::basic_string<CharT> result{};
+  for (std::size_t i = 0; i < n; ++i) {
+    result.append(i, static_cast<CharT>('a' + (i % 26)));
+    result.append(s);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("utf: ascii_prefix") {
+  std::u16string str(100, u'x');
+  CHECK(utf::ascii_prefix(str.data(), str.size()) == 100);
+  for (std::size_t i : {0, 1, 7, 8, 15, 16, 17, 33, 99}) {
+    std::u16string s = str;
+    s[i] = u'±';
+    CHECK(utf::ascii_prefix(s.data(), s.size()) == i);
+
+    std::u32string s32(s.begin(), s.end());
+    CHECK(utf::ascii_prefix(s32.data(), s32.size()) == i);
+
+    std::string s8(100, 'x');
+    s8[i] = '\x80';
+    CHECK(utf::ascii_prefix(s8.data(), s8.size()) == i);
+  }
+}
+
+TEST_CASE("utf: valid text") {
+  std::string const expected = as_string(u8"±4Å 日本 😀");
+  CHECK(to_utf8(u8"±4Å 日本 😀") == expected);
+  CHECK(to_utf8(u"±4Å 日本 😀") == expected);
+  CHECK(to_utf8(U"±4Å 日本 😀") == expected);
+  CHECK(to_utf8(L"±4Å 日本 😀") == expected);
+  CHECK(to_utf8(u"").empty());
+
+  // text longer than the transcoding buffer, with code points at each
+  // offset within a block
+  std::string const long_expected = with_prefixes(std::string_view{expected}, 300);
+  std::u8string const long8 = with_prefixes<char8_t>(u8"±4Å 日本 😀", 300);
+  std::u16string const long16 = with_prefixes<char16_t>(u"±4Å 日本 😀", 300);
+  std::u32string const long32 = with_prefixes<char32_t>(U"±4Å 日本 😀", 300);
+  CHECK(to_utf8(std::u8string_view{long8}) == long_expected);
+  CHECK(to_utf8(std::u16string_view{long16}) == long_expected);
+  CHECK(to_utf8(std::u32string_view{long32}) == long_expected);
+}
+
+TEST_CASE("utf: invalid sequences") {
+  // one replacement character for each maximal subpart
+  std::string_view const r = utf::replacement_utf8;
+  std::string_view const bytes{"\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64"};
+  CHECK(to_utf8(bytes) == "a" + std::string{r} + std::string{r} + std::string{r} + "b"
+                                + std::string{r} + "c" + std::string{r} + std::string{r}
+                                + "d");
+  CHECK(to_utf8(std::string_view{"\xED\xA0\x80"}) == std::string{r} + std::string{r}
+                                                          + std::string{r});
+  CHECK(to_utf8(std::string_view{"x\xE2\x82"}) == "x" + std::string{r});
+
+  char16_t const utf16[] = {u'A', 0xD800, u'B', 0xDC00, 0xD83D, 0xDE00};
+  CHECK(to_utf8(std::u16string_view{utf16, 6})
+        == "A" + std::string{r} + "B" + std::string{r} + as_string(u8"😀"));
+  CHECK(to_utf8(std::u16string_view{utf16, 2}) == "A" + std::string{r});
+
+  char32_t const utf32[] = {U'A', 0x110000, 0xD800, U'±'};
+  CHECK(to_utf8(std::u32string_view{utf32, 4})
+        == "A" + std::string{r} + std::string{r} + as_string(u8"±"));
+}